@@ -56,13 +56,12 @@ void copyProps(Alembic::Abc::ICompoundProperty & iRead,
 
             std::size_t numSamples = inProp.getNumSamples();
 
+            // Ogawa to Ogawa this transfers the stored data as it is
             for (std::size_t j = 0; j < numSamples; ++j)
             {
-                Alembic::AbcCoreAbstract::ArraySamplePtr samp;
                 Alembic::Abc::ISampleSelector sel(
                     (Alembic::Abc::index_t) j);
-                inProp.get(samp, sel);
-                outProp.set(*samp);
+                outProp.setFrom(inProp, sel);
             }
         }
         else if (header.isScalar())
@@ -0,0 +1,127 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+
+#include <iostream>
+
+//-*****************************************************************************
+const char * kindName( Alembic::Abc::ArchiveDifference::Kind iKind )
+{
+    switch ( iKind )
+    {
+        case Alembic::Abc::ArchiveDifference::kObjectAdded:
+            return "object added";
+        case Alembic::Abc::ArchiveDifference::kObjectRemoved:
+            return "object removed";
+        case Alembic::Abc::ArchiveDifference::kObjectMetaDataChanged:
+            return "object metadata changed";
+        case Alembic::Abc::ArchiveDifference::kPropertyAdded:
+            return "property added";
+        case Alembic::Abc::ArchiveDifference::kPropertyRemoved:
+            return "property removed";
+        case Alembic::Abc::ArchiveDifference::kPropertyHeaderChanged:
+            return "property header changed";
+        case Alembic::Abc::ArchiveDifference::kNumSamplesChanged:
+            return "number of samples changed";
+        case Alembic::Abc::ArchiveDifference::kSamplesChanged:
+            return "samples changed";
+    }
+    return "";
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    if ( argc != 3 )
+    {
+        printf( "Usage: abcdiff fileA fileB\n" );
+        printf( "Compares two Alembic files and prints the objects, " );
+        printf( "properties and\nsamples which differ.  Unchanged " );
+        printf( "hierarchies are skipped using the hashes\nstored in Ogawa " );
+        printf( "files, and array samples are compared by their keys\n" );
+        printf( "without reading their data.\n\n" );
+        printf( "Returns 0 if the files match, 1 if they differ and 2 on " );
+        printf( "errors.\n" );
+        return 2;
+    }
+
+    Alembic::AbcCoreFactory::IFactory factory;
+    Alembic::Abc::IArchive archiveA = factory.getArchive( argv[1] );
+    if ( !archiveA.valid() )
+    {
+        printf( "Error: Invalid Alembic file specified: %s\n", argv[1] );
+        return 2;
+    }
+
+    Alembic::Abc::IArchive archiveB = factory.getArchive( argv[2] );
+    if ( !archiveB.valid() )
+    {
+        printf( "Error: Invalid Alembic file specified: %s\n", argv[2] );
+        return 2;
+    }
+
+    std::vector< Alembic::Abc::ArchiveDifference > diffs;
+    try
+    {
+        Alembic::Abc::DiffArchives( archiveA, archiveB, diffs );
+    }
+    catch ( std::exception & e )
+    {
+        printf( "Error: %s\n", e.what() );
+        return 2;
+    }
+
+    for ( std::size_t i = 0; i < diffs.size(); ++i )
+    {
+        const Alembic::Abc::ArchiveDifference & diff = diffs[i];
+        std::cout << diff.objectPath;
+        if ( !diff.propertyPath.empty() )
+        {
+            std::cout << " " << diff.propertyPath;
+        }
+        std::cout << ": " << kindName( diff.kind );
+        if ( diff.kind == Alembic::Abc::ArchiveDifference::kSamplesChanged )
+        {
+            std::cout << " (samples " << diff.firstSample << " to "
+                      << diff.firstSample + diff.numSamples - 1 << ")";
+        }
+        std::cout << std::endl;
+    }
+
+    return diffs.empty() ? 0 : 1;
+}
@@ -50,6 +50,9 @@
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 
 using namespace Alembic::AbcGeom;
 using namespace Alembic::AbcCoreAbstract;
@@ -948,114 +951,122 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
     }
 
 }
+namespace {
 
 //-*****************************************************************************
+// An input file along with where its animated time samplings start, inputs
+// without any animated time samplings are sorted to the end.
+struct InputFile
+{
+    InputFile() : start(DBL_MAX) {}
+
+    std::string name;
+    chrono_t start;
+    std::string error;
+};
+
+bool startsBefore(const InputFile & iA, const InputFile & iB)
+{
+    return iA.start < iB.start;
+}
+
 //-*****************************************************************************
-// DO IT.
-//-*****************************************************************************
+// Whether the file starts with the Ogawa magic.  Anything else might be HDF5,
+// which can't be used from more than one thread.
+bool isOgawa(const std::string & iName)
+{
+    std::ifstream in(iName.c_str(), std::ios::binary);
+    char magic[5];
+    return in.read(magic, 5) && std::string(magic, 5) == "Ogawa";
+}
+
 //-*****************************************************************************
-int main( int argc, char *argv[] )
+// Opens an input just long enough to find out where it starts in time, so
+// that the inputs can be put in order without keeping all of them open.
+void scanInput(std::size_t iTask, void * iData)
 {
-    if (argc < 4)
-    {
-        std::cerr << "USAGE: " << argv[0] << " outFile.abc inFile1.abc"
-            << " inFile2.abc (inFile3.abc ...)" << std::endl;
-        return -1;
-    }
+    InputFile & input = (*static_cast< std::vector< InputFile > * >(iData))[
+        iTask];
 
+    try
     {
-        size_t numInputs = argc - 2;
-        std::vector< chrono_t > minVec;
+        Alembic::AbcCoreFactory::IFactory factory;
+        factory.setPolicy(ErrorHandler::kThrowPolicy);
+        Alembic::AbcCoreFactory::IFactory::CoreType coreType;
+        IArchive archive = factory.getArchive(input.name, coreType);
+        if (!archive.valid())
+        {
+            input.error = input.name + " not a valid Alembic file";
+            return;
+        }
 
-        minVec.reserve(numInputs);
+        Alembic::Util::uint32_t numSamplings = archive.getNumTimeSamplings();
+        if (numSamplings < 2)
+        {
+            return;
+        }
 
-        std::vector< IArchive > iArchives;
-        iArchives.reserve(numInputs);
+        // timesampling index 0 is special, so it will be skipped
+        //
+        // make sure all the other timesampling objects start at
+        // the same time or error here
+        //
+        chrono_t min = archive.getTimeSampling(1)->getSampleTime(0);
+        for (Alembic::Util::uint32_t s = 2; s < numSamplings; ++s)
+        {
+            chrono_t thisMin = archive.getTimeSampling(s)->getSampleTime(0);
+            if (fabs(thisMin - min) > 1e-5)
+            {
+                input.error = input.name + " has non-default TimeSampling"
+                    " objects that don't start at the same time.";
+                return;
+            }
+        }
 
-        std::map< chrono_t, size_t > minIndexMap;
+        input.start = min;
+    }
+    catch (std::exception & e)
+    {
+        input.error = e.what();
+    }
+}
 
+//-*****************************************************************************
+// Stitches iInputs, which are already in time order, into iOutFile.  Returns
+// an empty string on success, otherwise what went wrong.
+std::string stitchFiles(const std::vector< std::string > & iInputs,
+                        const std::string & iOutFile)
+{
+    try
+    {
         Alembic::AbcCoreFactory::IFactory factory;
         factory.setPolicy(ErrorHandler::kThrowPolicy);
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
         TimeAndSamplesMap timeMap;
 
-        for (int i = 2; i < argc; ++i)
-        {
+        std::vector< IObject > iRoots;
+        iRoots.reserve(iInputs.size());
 
-            IArchive archive = factory.getArchive(argv[i], coreType);
+        for (std::size_t i = 0; i < iInputs.size(); ++i)
+        {
+            IArchive archive = factory.getArchive(iInputs[i], coreType);
             if (!archive.valid())
             {
-                std::cerr << "ERROR: " << argv[i] <<
-                    " not a valid Alembic file" << std::endl;
-                return 1;
+                return iInputs[i] + " not a valid Alembic file";
             }
 
-            // reorder the input files according to their mins
-            chrono_t min = DBL_MAX;
-            Alembic::Util::uint32_t numSamplings = archive.getNumTimeSamplings();
-            timeMap.add(archive.getTimeSampling(0),
-                        archive.getMaxNumSamplesForTimeSamplingIndex(0));
-
-            if (numSamplings > 1)
+            Alembic::Util::uint32_t numSamplings =
+                archive.getNumTimeSamplings();
+            for (Alembic::Util::uint32_t s = 0; s < numSamplings; ++s)
             {
-                // timesampling index 0 is special, so it will be skipped
-                //
-                // make sure all the other timesampling objects start at
-                // the same time or throw here
-                //
-                min = archive.getTimeSampling(1)->getSampleTime(0);
-
-                timeMap.add(archive.getTimeSampling(1),
-                    archive.getMaxNumSamplesForTimeSamplingIndex(1));
-
-                for (Alembic::Util::uint32_t s = 2; s < numSamplings; ++s)
-                {
-                    timeMap.add(archive.getTimeSampling(s),
-                        archive.getMaxNumSamplesForTimeSamplingIndex(s));
-
-                    chrono_t thisMin =
-                        archive.getTimeSampling(s)->getSampleTime(0);
-
-                    if (fabs(thisMin - min) > 1e-5)
-                    {
-                        std::cerr << "ERROR: " << argv[i]
-                            << " has non-default TimeSampling objects"
-                            << " that don't start at the same time."
-                            << std::endl;
-                        return 1;
-                    }
-                }
-
-                minVec.push_back(min);
-                if (minIndexMap.count(min) == 0)
-                {
-                    minIndexMap.insert(std::make_pair(min, i-2));
-                }
-                else if (argv[2] != argv[i])
-                {
-                    std::cerr << "ERROR: overlapping frame range between "
-                        << argv[2] << " and " << argv[i] << std::endl;
-                    return 1;
-                }
+                timeMap.add(archive.getTimeSampling(s),
+                    archive.getMaxNumSamplesForTimeSamplingIndex(s));
             }
 
-            iArchives.push_back(archive);
-        }
-
-        // now reorder the input nodes so they are in increasing order of their
-        // min values in the frame range
-        std::sort(minVec.begin(), minVec.end());
-        std::vector< IArchive > iOrderedArchives;
-        iOrderedArchives.reserve(numInputs);
-
-        for (size_t f = 0; f < numInputs; ++f)
-        {
-            size_t index = minIndexMap.find(minVec[f])->second;
-            iOrderedArchives.push_back(iArchives[index]);
+            iRoots.push_back(archive.getTop());
         }
 
         std::string appWriter = "AbcStitcher";
-        std::string fileName = argv[1];
         std::string userStr;
 
         // Create an archive with the default writer
@@ -1064,31 +1075,219 @@ int main( int argc, char *argv[] )
         {
             oArchive = CreateArchiveWithInfo(
                 Alembic::AbcCoreOgawa::WriteArchive(),
-                fileName, appWriter, userStr, ErrorHandler::kThrowPolicy);
+                iOutFile, appWriter, userStr, ErrorHandler::kThrowPolicy);
         }
 #ifdef ALEMBIC_WITH_HDF5
         else if (coreType == Alembic::AbcCoreFactory::IFactory::kHDF5)
         {
             oArchive = CreateArchiveWithInfo(
                 Alembic::AbcCoreHDF5::WriteArchive(),
-                fileName, appWriter, userStr, ErrorHandler::kThrowPolicy);
+                iOutFile, appWriter, userStr, ErrorHandler::kThrowPolicy);
         }
 #endif
 
         OObject oRoot = oArchive.getTop();
         if (!oRoot.valid())
         {
+            return "could not create " + iOutFile;
+        }
+
+        visitObjects(iRoots, oRoot, timeMap);
+    }
+    catch (std::exception & e)
+    {
+        return e.what();
+    }
+
+    return std::string();
+}
+
+//-*****************************************************************************
+// One run of the stitcher over consecutive groups of the inputs, each group
+// is stitched into its own output so the groups can be done in parallel.
+struct StitchPass
+{
+    std::vector< std::vector< std::string > > groups;
+    std::vector< std::string > outputs;
+    std::vector< std::string > errors;
+};
+
+void stitchGroup(std::size_t iTask, void * iData)
+{
+    StitchPass & pass = *static_cast< StitchPass * >(iData);
+    pass.errors[iTask] = stitchFiles(pass.groups[iTask], pass.outputs[iTask]);
+}
+
+void removeFiles(const std::vector< std::string > & iFiles)
+{
+    for (std::size_t i = 0; i < iFiles.size(); ++i)
+    {
+        std::remove(iFiles[i].c_str());
+    }
+}
+
+void printUsage(const char * iExe)
+{
+    std::cerr << "USAGE: " << iExe << " [-j numThreads] [-w windowSize]"
+        << " outFile.abc inFile1.abc inFile2.abc (inFile3.abc ...)\n\n"
+        << "  -j  number of threads to stitch with, 0 uses one per processor"
+        << " (default 1)\n"
+        << "  -w  most inputs open at once by a thread, larger stitches are"
+        << " done in passes\n      through intermediate files next to"
+        << " outFile.abc (default all of them\n      with one thread, otherwise"
+        << " at most 64)" << std::endl;
+}
+
+}
+
+//-*****************************************************************************
+//-*****************************************************************************
+// DO IT.
+//-*****************************************************************************
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::size_t numThreads = 1;
+    std::size_t window = 0;
+
+    int arg = 1;
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        std::string opt = argv[arg];
+        std::size_t value = static_cast< std::size_t >(atoi(argv[arg + 1]));
+        if (opt == "-j")
+        {
+            Alembic::Abc::ParallelVisitOptions threadOpts;
+            threadOpts.numThreads = value;
+            numThreads = Alembic::Abc::GetParallelVisitNumThreads(threadOpts);
+        }
+        else if (opt == "-w")
+        {
+            window = value;
+        }
+        else
+        {
+            printUsage(argv[0]);
             return -1;
         }
+    }
 
-        std::vector<IObject> iRoots(numInputs);
+    if (argc - arg < 3)
+    {
+        printUsage(argv[0]);
+        return -1;
+    }
 
-        for (size_t e = 0; e < numInputs; ++e)
+    std::string fileName = argv[arg];
+
+    std::vector< InputFile > inputs(argc - arg - 1);
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        inputs[i].name = argv[arg + 1 + i];
+    }
+
+    // the HDF5 library can't be used from more than one thread, so that has
+    // to be known before any input is opened
+    for (std::size_t i = 0; i < inputs.size() && numThreads > 1; ++i)
+    {
+        if (!isOgawa(inputs[i].name))
         {
-            iRoots[e] = iOrderedArchives[e].getTop();
+            numThreads = 1;
         }
+    }
 
-        visitObjects(iRoots, oRoot, timeMap);
+    Alembic::Util::ParallelTasks(inputs.size(), numThreads, scanInput,
+                                 &inputs);
+
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        if (!inputs[i].error.empty())
+        {
+            std::cerr << "ERROR: " << inputs[i].error << std::endl;
+            return 1;
+        }
+    }
+
+    // now reorder the inputs so they are in increasing order of their
+    // min values in the frame range
+    std::stable_sort(inputs.begin(), inputs.end(), startsBefore);
+
+    std::vector< std::string > names;
+    names.reserve(inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        if (i > 0 && inputs[i].start != DBL_MAX &&
+            inputs[i].start == inputs[i - 1].start)
+        {
+            std::cerr << "ERROR: overlapping frame range between "
+                << inputs[i - 1].name << " and " << inputs[i].name
+                << std::endl;
+            return 1;
+        }
+
+        names.push_back(inputs[i].name);
+    }
+
+    if (window == 0)
+    {
+        window = names.size();
+        if (numThreads > 1)
+        {
+            window = std::min< std::size_t >(
+                (names.size() + numThreads - 1) / numThreads, 64);
+        }
+    }
+    window = std::max< std::size_t >(window, 2);
+
+    // stitch consecutive groups of at most window inputs into intermediate
+    // files until few enough are left to be stitched into fileName, this
+    // keeps every group in time order and bounds how many files are open
+    std::vector< std::string > intermediates;
+    for (std::size_t level = 0; names.size() > window; ++level)
+    {
+        std::size_t numGroups = (names.size() + window - 1) / window;
+        std::size_t groupSize = (names.size() + numGroups - 1) / numGroups;
+
+        StitchPass pass;
+        pass.groups.resize(numGroups);
+        pass.errors.resize(numGroups);
+        for (std::size_t g = 0; g < numGroups; ++g)
+        {
+            std::size_t first = g * groupSize;
+            std::size_t last = std::min(first + groupSize, names.size());
+            pass.groups[g].assign(names.begin() + first, names.begin() + last);
+
+            std::ostringstream part;
+            part << fileName << "." << level << "_" << g << ".part";
+            pass.outputs.push_back(part.str());
+        }
+
+        Alembic::Util::ParallelTasks(numGroups, numThreads, stitchGroup,
+                                     &pass);
+
+        removeFiles(intermediates);
+        intermediates = pass.outputs;
+
+        for (std::size_t g = 0; g < numGroups; ++g)
+        {
+            if (!pass.errors[g].empty())
+            {
+                std::cerr << "ERROR: " << pass.errors[g] << std::endl;
+                removeFiles(intermediates);
+                return 1;
+            }
+        }
+
+        names = pass.outputs;
+    }
+
+    std::string error = stitchFiles(names, fileName);
+    removeFiles(intermediates);
+
+    if (!error.empty())
+    {
+        std::cerr << "ERROR: " << error << std::endl;
+        return 1;
     }
 
     return 0;
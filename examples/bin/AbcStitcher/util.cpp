@@ -186,7 +186,6 @@ void stitchArrayProp(const PropertyHeader & propHeader,
         IArrayProperty reader(iCompoundProps[iCpIndex], propName);
         index_t numSamples = reader.getNumSamples();
 
-        ArraySamplePtr dataPtr;
         index_t numEmpty;
         index_t k = getIndexSample(writer.getNumSamples(),
             writer.getTimeSampling(), numSamples,
@@ -198,10 +197,10 @@ void stitchArrayProp(const PropertyHeader & propHeader,
                 writer.set(emptySample);
         }
 
+        // between Ogawa archives the stored data is copied as it is
         for (; k < numSamples; k++)
         {
-            reader.get(dataPtr, k);
-            writer.set(*dataPtr);
+            writer.setFrom(reader, k);
         }
     }
 
@@ -42,6 +42,8 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/Abc/Foundation.h>
 
+#include <Alembic/Abc/ArchiveCopy.h>
+#include <Alembic/Abc/ArchiveDiff.h>
 #include <Alembic/Abc/ArchiveInfo.h>
 #include <Alembic/Abc/Argument.h>
 #include <Alembic/Abc/IArchive.h>
@@ -66,8 +68,11 @@
 #include <Alembic/Abc/OSchemaObject.h>
 #include <Alembic/Abc/OTypedArrayProperty.h>
 #include <Alembic/Abc/OTypedScalarProperty.h>
+#include <Alembic/Abc/ObjectPathIndex.h>
 
+#include <Alembic/Abc/ParallelVisit.h>
 #include <Alembic/Abc/Reference.h>
+#include <Alembic/Abc/SampleIndexCache.h>
 #include <Alembic/Abc/SourceName.h>
 
 #include <Alembic/Abc/TypedArraySample.h>
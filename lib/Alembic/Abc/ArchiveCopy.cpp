@@ -0,0 +1,249 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/ArchiveCopy.h>
+#include <Alembic/Abc/IArrayProperty.h>
+#include <Alembic/Abc/IScalarProperty.h>
+#include <Alembic/Abc/OArrayProperty.h>
+#include <Alembic/Abc/OScalarProperty.h>
+#include <Alembic/Abc/OTypedScalarProperty.h>
+
+#include <map>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+void copyArrayProperty( ICompoundProperty & iIn, OCompoundProperty & iOut,
+                        const AbcA::PropertyHeader & iHeader )
+{
+    IArrayProperty inProp( iIn, iHeader.getName() );
+    OArrayProperty outProp( iOut, iHeader.getName(), iHeader.getDataType(),
+                            iHeader.getMetaData(),
+                            iHeader.getTimeSampling() );
+
+    // between Ogawa archives this copies the stored data without decoding
+    // or hashing it
+    std::size_t numSamples = inProp.getNumSamples();
+    for ( std::size_t i = 0; i < numSamples; ++i )
+    {
+        outProp.setFrom( inProp, ISampleSelector( ( index_t ) i ) );
+    }
+}
+
+//-*****************************************************************************
+void copyScalarProperty( ICompoundProperty & iIn, OCompoundProperty & iOut,
+                         const AbcA::PropertyHeader & iHeader )
+{
+    IScalarProperty inProp( iIn, iHeader.getName() );
+    OScalarProperty outProp( iOut, iHeader.getName(), iHeader.getDataType(),
+                             iHeader.getMetaData(),
+                             iHeader.getTimeSampling() );
+
+    const AbcA::DataType & dataType = iHeader.getDataType();
+    std::size_t extent = dataType.getExtent();
+
+    // strings need to be read into the real types, everything else is POD
+    std::vector< std::string > strs;
+    std::vector< std::wstring > wstrs;
+    std::vector< char > bytes;
+    void * samp = NULL;
+    if ( dataType.getPod() == kStringPOD )
+    {
+        strs.resize( extent );
+        samp = &strs.front();
+    }
+    else if ( dataType.getPod() == kWstringPOD )
+    {
+        wstrs.resize( extent );
+        samp = &wstrs.front();
+    }
+    else
+    {
+        bytes.resize( dataType.getNumBytes() );
+        samp = &bytes.front();
+    }
+
+    std::size_t numSamples = inProp.getNumSamples();
+    for ( std::size_t i = 0; i < numSamples; ++i )
+    {
+        inProp.get( samp, ISampleSelector( ( index_t ) i ) );
+        outProp.set( samp );
+    }
+}
+
+//-*****************************************************************************
+class ArchiveCopier
+{
+public:
+    ArchiveCopier( const CopyArchiveOptions & iOptions )
+      : m_options( iOptions )
+      , m_numInstanced( 0 )
+    {}
+
+    void copyObject( IObject & iIn, OObject & iOut );
+
+    std::size_t getNumInstanced() const { return m_numInstanced; }
+
+private:
+    bool getSubtreeKey( IObject & iObj, std::string & oKey );
+
+    const CopyArchiveOptions & m_options;
+
+    // subtree key to the full name of the first copy written
+    std::map< std::string, std::string > m_written;
+
+    std::size_t m_numInstanced;
+};
+
+//-*****************************************************************************
+bool ArchiveCopier::getSubtreeKey( IObject & iObj, std::string & oKey )
+{
+    // an empty object is cheaper to write than an instance of one
+    if ( iObj.getNumChildren() == 0 &&
+         iObj.getProperties().getNumProperties() == 0 )
+    {
+        return false;
+    }
+
+    Util::Digest propsHash, childrenHash;
+    if ( !iObj.getPropertiesHash( propsHash ) ||
+         !iObj.getChildrenHash( childrenHash ) )
+    {
+        return false;
+    }
+
+    // the hashes don't include the object's own header
+    oKey = propsHash.str() + childrenHash.str() +
+        iObj.getMetaData().serialize();
+    return true;
+}
+
+//-*****************************************************************************
+void ArchiveCopier::copyObject( IObject & iIn, OObject & iOut )
+{
+    CopyProperties( iIn.getProperties(), iOut.getProperties() );
+
+    std::string parentPath = iOut.getFullName();
+    if ( parentPath != "/" )
+    {
+        parentPath += "/";
+    }
+
+    std::size_t numChildren = iIn.getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        IObject childIn( iIn.getChild( i ) );
+        const std::string & name = childIn.getName();
+
+        std::string key;
+        if ( m_options.instanceDuplicates && getSubtreeKey( childIn, key ) )
+        {
+            std::map< std::string, std::string >::iterator it =
+                m_written.find( key );
+
+            if ( it != m_written.end() )
+            {
+                // the same thing OObject::addChildInstance writes, without
+                // needing to keep the target OObject alive
+                AbcA::MetaData md;
+                md.set( "isInstance", "1" );
+                OObject instanceChild( iOut, name, md );
+                OStringProperty instanceProp( instanceChild.getProperties(),
+                                              ".instanceSource" );
+                instanceProp.set( it->second );
+                ++m_numInstanced;
+                continue;
+            }
+
+            m_written[key] = parentPath + name;
+        }
+
+        OObject childOut( iOut, name, childIn.getMetaData() );
+        copyObject( childIn, childOut );
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void CopyProperties( ICompoundProperty iIn, OCompoundProperty iOut )
+{
+    std::size_t numProps = iIn.getNumProperties();
+    for ( std::size_t i = 0; i < numProps; ++i )
+    {
+        const AbcA::PropertyHeader & header = iIn.getPropertyHeader( i );
+        if ( header.isArray() )
+        {
+            copyArrayProperty( iIn, iOut, header );
+        }
+        else if ( header.isScalar() )
+        {
+            copyScalarProperty( iIn, iOut, header );
+        }
+        else if ( header.isCompound() )
+        {
+            CopyProperties( ICompoundProperty( iIn, header.getName() ),
+                            OCompoundProperty( iOut, header.getName(),
+                                               header.getMetaData() ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+std::size_t CopyArchive( IArchive iIn, OArchive iOut,
+                         const CopyArchiveOptions & iOptions )
+{
+    // start at 1, index 0 is the intrinsic default which always exists
+    for ( Util::uint32_t i = 1; i < iIn.getNumTimeSamplings(); ++i )
+    {
+        iOut.addTimeSampling( *iIn.getTimeSampling( i ) );
+    }
+
+    IObject inTop = iIn.getTop();
+    OObject outTop = iOut.getTop();
+
+    ArchiveCopier copier( iOptions );
+    copier.copyObject( inTop, outTop );
+    return copier.getNumInstanced();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,88 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_ArchiveCopy_h_
+#define _Alembic_Abc_ArchiveCopy_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/IArchive.h>
+#include <Alembic/Abc/ICompoundProperty.h>
+#include <Alembic/Abc/IObject.h>
+#include <Alembic/Abc/OArchive.h>
+#include <Alembic/Abc/OCompoundProperty.h>
+#include <Alembic/Abc/OObject.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+struct CopyArchiveOptions
+{
+    CopyArchiveOptions()
+      : instanceDuplicates( false )
+    {}
+
+    //! Whether object subtrees which are identical to one which has already
+    //! been copied are written as instances of that first copy instead.
+    //! Subtrees are matched by the object MetaData and the properties and
+    //! children hashes stored by the reader, so no sample data is compared.
+    //! Readers which don't store these hashes (HDF5) are copied in full.
+    bool instanceDuplicates;
+};
+
+//-*****************************************************************************
+//! Copies every property of iIn, and all of their samples, to iOut.
+ALEMBIC_EXPORT void
+CopyProperties( ICompoundProperty iIn, OCompoundProperty iOut );
+
+//-*****************************************************************************
+//! Copies the time samplings and the whole hierarchy of iIn to iOut, which
+//! is expected to be freshly created (with the MetaData of iIn if wanted.)
+//! Returns the number of subtrees that were written as instances.
+ALEMBIC_EXPORT std::size_t
+CopyArchive( IArchive iIn, OArchive iOut,
+             const CopyArchiveOptions & iOptions = CopyArchiveOptions() );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,389 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/ArchiveDiff.h>
+#include <Alembic/Abc/IArrayProperty.h>
+#include <Alembic/Abc/ICompoundProperty.h>
+#include <Alembic/Abc/IObject.h>
+#include <Alembic/Abc/IScalarProperty.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+class ArchiveDiffer
+{
+public:
+    ArchiveDiffer( std::vector< ArchiveDifference > & oDiffs )
+      : m_diffs( oDiffs )
+    {}
+
+    void diffObject( IObject & iA, IObject & iB );
+
+private:
+    void diffProperties( ICompoundProperty & iA, ICompoundProperty & iB,
+                         const std::string & iPath );
+
+    void diffArraySamples( ICompoundProperty & iA, ICompoundProperty & iB,
+                           const std::string & iName,
+                           const std::string & iPath );
+
+    void diffScalarSamples( ICompoundProperty & iA, ICompoundProperty & iB,
+                            const AbcA::PropertyHeader & iHeader,
+                            const std::string & iPath );
+
+    void add( ArchiveDifference::Kind iKind,
+              const std::string & iPropertyPath = std::string(),
+              index_t iFirstSample = 0, std::size_t iNumSamples = 0 );
+
+    void addChangedSample( const std::string & iPropertyPath,
+                           index_t iSample );
+
+    std::vector< ArchiveDifference > & m_diffs;
+    std::string m_objectPath;
+};
+
+//-*****************************************************************************
+void ArchiveDiffer::add( ArchiveDifference::Kind iKind,
+                         const std::string & iPropertyPath,
+                         index_t iFirstSample, std::size_t iNumSamples )
+{
+    ArchiveDifference diff;
+    diff.kind = iKind;
+    diff.objectPath = m_objectPath;
+    diff.propertyPath = iPropertyPath;
+    diff.firstSample = iFirstSample;
+    diff.numSamples = iNumSamples;
+    m_diffs.push_back( diff );
+}
+
+//-*****************************************************************************
+// Samples are visited in order, so a sample right after the run of changed
+// samples which was added last for the same property extends it, otherwise
+// it starts a new run.
+void ArchiveDiffer::addChangedSample( const std::string & iPropertyPath,
+                                      index_t iSample )
+{
+    if ( !m_diffs.empty() )
+    {
+        ArchiveDifference & last = m_diffs.back();
+        if ( last.kind == ArchiveDifference::kSamplesChanged &&
+             last.objectPath == m_objectPath &&
+             last.propertyPath == iPropertyPath &&
+             last.firstSample + ( index_t ) last.numSamples == iSample )
+        {
+            ++last.numSamples;
+            return;
+        }
+    }
+
+    add( ArchiveDifference::kSamplesChanged, iPropertyPath, iSample, 1 );
+}
+
+//-*****************************************************************************
+bool sameHeader( const AbcA::PropertyHeader & iA,
+                 const AbcA::PropertyHeader & iB )
+{
+    if ( iA.getPropertyType() != iB.getPropertyType() ||
+         iA.getMetaData().serialize() != iB.getMetaData().serialize() )
+    {
+        return false;
+    }
+
+    if ( iA.isCompound() )
+    {
+        return true;
+    }
+
+    return iA.getDataType() == iB.getDataType() &&
+        *iA.getTimeSampling() == *iB.getTimeSampling();
+}
+
+//-*****************************************************************************
+void ArchiveDiffer::diffArraySamples( ICompoundProperty & iA,
+                                      ICompoundProperty & iB,
+                                      const std::string & iName,
+                                      const std::string & iPath )
+{
+    IArrayProperty propA( iA, iName );
+    IArrayProperty propB( iB, iName );
+
+    std::size_t numA = propA.getNumSamples();
+    std::size_t numB = propB.getNumSamples();
+    if ( numA != numB )
+    {
+        add( ArchiveDifference::kNumSamplesChanged, iPath );
+    }
+
+    std::size_t numSamples = std::min( numA, numB );
+    for ( std::size_t i = 0; i < numSamples; ++i )
+    {
+        ISampleSelector sel( ( index_t ) i );
+        AbcA::ArraySampleKey keyA, keyB;
+        bool hasA = propA.getKey( keyA, sel );
+        bool hasB = propB.getKey( keyB, sel );
+
+        if ( hasA != hasB || !( keyA == keyB ) )
+        {
+            addChangedSample( iPath, ( index_t ) i );
+            continue;
+        }
+
+        // the dimensions aren't part of the key, but they are cheap to read
+        Util::Dimensions dimsA, dimsB;
+        propA.getDimensions( dimsA, sel );
+        propB.getDimensions( dimsB, sel );
+        if ( !( dimsA == dimsB ) )
+        {
+            addChangedSample( iPath, ( index_t ) i );
+        }
+    }
+}
+
+//-*****************************************************************************
+void ArchiveDiffer::diffScalarSamples( ICompoundProperty & iA,
+                                       ICompoundProperty & iB,
+                                       const AbcA::PropertyHeader & iHeader,
+                                       const std::string & iPath )
+{
+    IScalarProperty propA( iA, iHeader.getName() );
+    IScalarProperty propB( iB, iHeader.getName() );
+
+    std::size_t numA = propA.getNumSamples();
+    std::size_t numB = propB.getNumSamples();
+    if ( numA != numB )
+    {
+        add( ArchiveDifference::kNumSamplesChanged, iPath );
+    }
+
+    const AbcA::DataType & dataType = iHeader.getDataType();
+    std::size_t extent = dataType.getExtent();
+    PlainOldDataType pod = dataType.getPod();
+
+    std::vector< std::string > strsA, strsB;
+    std::vector< std::wstring > wstrsA, wstrsB;
+    std::vector< char > bytesA, bytesB;
+    void * sampA = NULL;
+    void * sampB = NULL;
+    if ( pod == kStringPOD )
+    {
+        strsA.resize( extent );
+        strsB.resize( extent );
+        sampA = &strsA.front();
+        sampB = &strsB.front();
+    }
+    else if ( pod == kWstringPOD )
+    {
+        wstrsA.resize( extent );
+        wstrsB.resize( extent );
+        sampA = &wstrsA.front();
+        sampB = &wstrsB.front();
+    }
+    else
+    {
+        bytesA.resize( dataType.getNumBytes() );
+        bytesB.resize( dataType.getNumBytes() );
+        sampA = &bytesA.front();
+        sampB = &bytesB.front();
+    }
+
+    std::size_t numSamples = std::min( numA, numB );
+    for ( std::size_t i = 0; i < numSamples; ++i )
+    {
+        ISampleSelector sel( ( index_t ) i );
+        propA.get( sampA, sel );
+        propB.get( sampB, sel );
+
+        bool same = false;
+        if ( pod == kStringPOD )
+        {
+            same = ( strsA == strsB );
+        }
+        else if ( pod == kWstringPOD )
+        {
+            same = ( wstrsA == wstrsB );
+        }
+        else
+        {
+            same = ( std::memcmp( sampA, sampB, bytesA.size() ) == 0 );
+        }
+
+        if ( !same )
+        {
+            addChangedSample( iPath, ( index_t ) i );
+        }
+    }
+}
+
+//-*****************************************************************************
+void ArchiveDiffer::diffProperties( ICompoundProperty & iA,
+                                    ICompoundProperty & iB,
+                                    const std::string & iPath )
+{
+    std::size_t numProps = iA.getNumProperties();
+    for ( std::size_t i = 0; i < numProps; ++i )
+    {
+        const AbcA::PropertyHeader & headerA = iA.getPropertyHeader( i );
+        const std::string & name = headerA.getName();
+        std::string path = iPath.empty() ? name : iPath + "/" + name;
+
+        const AbcA::PropertyHeader * headerB = iB.getPropertyHeader( name );
+        if ( !headerB )
+        {
+            add( ArchiveDifference::kPropertyRemoved, path );
+            continue;
+        }
+
+        if ( !sameHeader( headerA, *headerB ) )
+        {
+            add( ArchiveDifference::kPropertyHeaderChanged, path );
+        }
+        else if ( headerA.isCompound() )
+        {
+            ICompoundProperty childA( iA, name );
+            ICompoundProperty childB( iB, name );
+            diffProperties( childA, childB, path );
+        }
+        else if ( headerA.isArray() )
+        {
+            diffArraySamples( iA, iB, name, path );
+        }
+        else
+        {
+            diffScalarSamples( iA, iB, headerA, path );
+        }
+    }
+
+    numProps = iB.getNumProperties();
+    for ( std::size_t i = 0; i < numProps; ++i )
+    {
+        const std::string & name = iB.getPropertyHeader( i ).getName();
+        if ( !iA.getPropertyHeader( name ) )
+        {
+            add( ArchiveDifference::kPropertyAdded,
+                 iPath.empty() ? name : iPath + "/" + name );
+        }
+    }
+}
+
+//-*****************************************************************************
+void ArchiveDiffer::diffObject( IObject & iA, IObject & iB )
+{
+    m_objectPath = iA.getFullName();
+
+    if ( iA.getMetaData().serialize() != iB.getMetaData().serialize() )
+    {
+        add( ArchiveDifference::kObjectMetaDataChanged );
+    }
+
+    Util::Digest hashA, hashB;
+    bool sameProps = iA.getPropertiesHash( hashA ) &&
+        iB.getPropertiesHash( hashB ) && hashA == hashB;
+
+    if ( !sameProps )
+    {
+        ICompoundProperty propsA = iA.getProperties();
+        ICompoundProperty propsB = iB.getProperties();
+        diffProperties( propsA, propsB, std::string() );
+    }
+
+    // the children hash covers everything below the children too
+    if ( iA.getChildrenHash( hashA ) && iB.getChildrenHash( hashB ) &&
+         hashA == hashB )
+    {
+        return;
+    }
+
+    std::string parentPath = m_objectPath;
+    if ( parentPath != "/" )
+    {
+        parentPath += "/";
+    }
+
+    std::size_t numChildren = iA.getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        IObject childA = iA.getChild( i );
+        const std::string & name = childA.getName();
+        if ( !iB.getChildHeader( name ) )
+        {
+            m_objectPath = parentPath + name;
+            add( ArchiveDifference::kObjectRemoved );
+            continue;
+        }
+
+        IObject childB = iB.getChild( name );
+        diffObject( childA, childB );
+    }
+
+    numChildren = iB.getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        const std::string & name = iB.getChildHeader( i ).getName();
+        if ( !iA.getChildHeader( name ) )
+        {
+            m_objectPath = parentPath + name;
+            add( ArchiveDifference::kObjectAdded );
+        }
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+bool DiffArchives( IArchive iA, IArchive iB,
+                   std::vector< ArchiveDifference > & oDiffs )
+{
+    std::size_t numDiffs = oDiffs.size();
+
+    IObject topA = iA.getTop();
+    IObject topB = iB.getTop();
+
+    ArchiveDiffer differ( oDiffs );
+    differ.diffObject( topA, topB );
+
+    return oDiffs.size() == numDiffs;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,109 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_ArchiveDiff_h_
+#define _Alembic_Abc_ArchiveDiff_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/IArchive.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! One difference found by DiffArchives
+struct ArchiveDifference
+{
+    enum Kind
+    {
+        kObjectAdded,
+        kObjectRemoved,
+        kObjectMetaDataChanged,
+        kPropertyAdded,
+        kPropertyRemoved,
+
+        //! The property type, data type, MetaData or time sampling differ,
+        //! the samples aren't compared.
+        kPropertyHeaderChanged,
+        kNumSamplesChanged,
+        kSamplesChanged
+    };
+
+    ArchiveDifference()
+      : kind( kObjectAdded )
+      , firstSample( 0 )
+      , numSamples( 0 )
+    {}
+
+    Kind kind;
+
+    //! Full name of the object
+    std::string objectPath;
+
+    //! Path of the property below the object, like ".geom/P", empty for the
+    //! object differences.
+    std::string propertyPath;
+
+    //! For kSamplesChanged, the index of the first of a run of consecutive
+    //! samples which differ and how many of them there are.  Each run gets
+    //! its own difference.
+    index_t firstSample;
+    std::size_t numSamples;
+};
+
+//-*****************************************************************************
+//! Compares two archives top down and appends what differs to oDiffs.
+//! Returns true if no difference was found.
+//!
+//! Objects whose stored properties and children hashes (Ogawa) are equal in
+//! both archives are not looked into, so unchanged subtrees cost one read of
+//! their header.  Array samples are compared by their keys, which are
+//! stored with the data, so no array payload is read.  Scalar samples are
+//! small and are read and compared directly.
+ALEMBIC_EXPORT bool
+DiffArchives( IArchive iA, IArchive iB,
+              std::vector< ArchiveDifference > & oDiffs );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -75,6 +75,23 @@ IObject IArchive::getTop()
     return IObject();
 }
 
+//-*****************************************************************************
+IObject IArchive::findObject( const std::string &iFullName )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::findObject()" );
+
+    AbcA::ObjectReaderPtr obj = m_objectIndex->find( m_archive, iFullName );
+    if ( obj )
+    {
+        return IObject( obj, kWrapExisting, getErrorHandlerPolicy() );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not found, or not all error handlers throw.
+    return IObject();
+}
+
 //-*****************************************************************************
 AbcA::ReadArraySampleCachePtr IArchive::getReadArraySampleCachePtr()
 {
@@ -152,6 +169,30 @@ void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+AbcA::ArraySampleAllocatorPtr IArchive::getArraySampleAllocator()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getArraySampleAllocator" );
+
+    return m_archive->getArraySampleAllocator();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw,
+    // so return a NO-OP value.
+    return AbcA::ArraySampleAllocatorPtr();
+}
+
+//-*****************************************************************************
+void IArchive::setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iPtr )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::setArraySampleAllocator" );
+
+    m_archive->setArraySampleAllocator( iPtr );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Abc
 } // End namespace Alembic
@@ -41,6 +41,8 @@
 #include <Alembic/Abc/Foundation.h>
 #include <Alembic/Abc/Base.h>
 #include <Alembic/Abc/Argument.h>
+#include <Alembic/Abc/ObjectPathIndex.h>
+#include <Alembic/Abc/SampleIndexCache.h>
 
 namespace Alembic {
 namespace Abc {
@@ -98,6 +100,8 @@ public:
         //! ...
         ErrorHandler::Policy iPolicy = ErrorHandler::kThrowPolicy )
       : m_archive( iPtr )
+      , m_objectIndex( new ObjectPathIndex() )
+      , m_sampleIndexCache( SampleIndexCache::get( iPtr ) )
     {
         // Set the error handling policy.
         getErrorHandler().setPolicy( iPolicy );
@@ -122,6 +126,16 @@ public:
     //! automatically as part of the archive.
     IObject getTop();
 
+    //! This returns the IObject with the given full name, such as
+    //! "/a/b/c", without having to walk down to it from the top.
+    //! Repeated lookups are served from an index kept by this IArchive and
+    //! its copies, see ObjectPathIndex. If no object by that name exists,
+    //! an invalid IObject is returned.
+    IObject findObject( const std::string &iFullName );
+
+    //! The index findObject keeps, for example to clear it.
+    ObjectPathIndexPtr getObjectPathIndex() { return m_objectIndex; }
+
     //! Get the read array sample cache. It may be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will is disabled if a NULL cache is returned here.
@@ -132,6 +146,20 @@ public:
     //! will be disabled if a NULL cache is passed here.
     void setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr );
 
+    //! Get the allocator the array samples read from this archive get their
+    //! buffers from. A NULL pointer means they are allocated with new[].
+    AbcA::ArraySampleAllocatorPtr getArraySampleAllocator();
+
+    //! Set the allocator for the array samples read from this archive, for
+    //! example an AbcA::PooledArraySampleAllocator to recycle the buffers
+    //! from one frame to the next. It may be a NULL pointer.
+    void setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iPtr );
+
+    //! The memo of the sample indices which time based ISampleSelectors
+    //! resolved to in this archive.  It is shared by every IArchive on the
+    //! same archive, and used while any of them are around.
+    SampleIndexCachePtr getSampleIndexCache() { return m_sampleIndexCache; }
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
@@ -145,7 +173,13 @@ public:
 
     //! Reset returns this function et to an empty, default
     //! state.
-    void reset() { m_archive.reset(); Base::reset(); }
+    void reset()
+    {
+        m_archive.reset();
+        m_objectIndex.reset();
+        m_sampleIndexCache.reset();
+        Base::reset();
+    }
 
     //! Returns the TimeSampling at a given index.
     AbcA::TimeSamplingPtr getTimeSampling( uint32_t iIndex );
@@ -177,6 +211,8 @@ public:
 
 private:
     AbcA::ArchiveReaderPtr m_archive;
+    ObjectPathIndexPtr m_objectIndex;
+    SampleIndexCachePtr m_sampleIndexCache;
 };
 
 //-*****************************************************************************
@@ -199,6 +235,8 @@ IArchive::IArchive( ARCHIVE_CTOR iCtor,
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::IArchive( iFileName )" );
 
     m_archive = iCtor( iFileName, iCachePtr );
+    m_objectIndex.reset( new ObjectPathIndex() );
+    m_sampleIndexCache = SampleIndexCache::get( m_archive );
 
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 
@@ -106,13 +106,61 @@ void IArrayProperty::get( AbcA::ArraySamplePtr& oSamp,
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::get()" );
 
     m_property->getSample(
-        iSS.getIndex( m_property->getTimeSampling(),
+        iSS.getIndex( *m_property,
                       m_property->getNumSamples() ),
         oSamp );
 
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void IArrayProperty::getRange( AbcA::ArraySamplePtr& oSamp,
+                               size_t iElementOffset,
+                               size_t iNumElements,
+                               const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getRange()" );
+
+    m_property->getSampleRange(
+        iSS.getIndex( *m_property,
+                      m_property->getNumSamples() ),
+        iElementOffset, iNumElements, oSamp );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+size_t IArrayProperty::getInto( void * oBuffer,
+                                size_t iCapacity,
+                                const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getInto()" );
+
+    index_t index = iSS.getIndex( *m_property,
+                                  m_property->getNumSamples() );
+
+    Util::Dimensions dims;
+    m_property->getDimensions( index, dims );
+    size_t numPoints = dims.numPoints();
+
+    ABCA_ASSERT( numPoints <= iCapacity,
+                 "Buffer too small, the sample has " << numPoints
+                 << " elements but there is room for only " << iCapacity );
+
+    if ( numPoints > 0 )
+    {
+        m_property->getAs( index, oBuffer,
+                           m_property->getDataType().getPod() );
+    }
+
+    return numPoints;
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, return a default.
+    return 0;
+}
+
 //-*****************************************************************************
 void IArrayProperty::getAs( void * oSample,
                             AbcA::PlainOldDataType iPod,
@@ -120,7 +168,7 @@ void IArrayProperty::getAs( void * oSample,
 {
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getAs(PlainOldDataType)" );
 
-    m_property->getAs( iSS.getIndex( m_property->getTimeSampling(),
+    m_property->getAs( iSS.getIndex( *m_property,
                                      m_property->getNumSamples() ),
                        oSample,
                        iPod
@@ -135,7 +183,7 @@ void IArrayProperty::getAs( void * oSample,
 {
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getAs()" );
 
-    m_property->getAs( iSS.getIndex( m_property->getTimeSampling(),
+    m_property->getAs( iSS.getIndex( *m_property,
                                      m_property->getNumSamples() ),
                        oSample,
                        m_property->getDataType().getPod()
@@ -151,7 +199,7 @@ bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getKey()" );
 
     return m_property->getKey(
-        iSS.getIndex( m_property->getTimeSampling(),
+        iSS.getIndex( *m_property,
                       m_property->getNumSamples() ),
         oKey );
 
@@ -168,7 +216,7 @@ void IArrayProperty::getDimensions( Util::Dimensions & oDim,
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getDimensions()" );
 
     m_property->getDimensions(
-        iSS.getIndex( m_property->getTimeSampling(),
+        iSS.getIndex( *m_property,
                       m_property->getNumSamples() ),
         oDim );
 
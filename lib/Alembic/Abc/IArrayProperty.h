@@ -130,6 +130,14 @@ public:
     void get( AbcA::ArraySamplePtr& oSample,
               const ISampleSelector &iSS = ISampleSelector() ) const;
 
+    //! Get only iNumElements elements of a sample, starting at
+    //! iElementOffset.  Only the requested range is read from the archive
+    //! when the underlying implementation supports it.
+    void getRange( AbcA::ArraySamplePtr& oSample,
+                   size_t iElementOffset,
+                   size_t iNumElements,
+                   const ISampleSelector &iSS = ISampleSelector() ) const;
+
     //! Get a sample into the address of a datum as a particular POD type.
     void getAs( void *oSample, AbcA::PlainOldDataType iPod,
                 const ISampleSelector &iSS = ISampleSelector() );
@@ -139,6 +147,13 @@ public:
     void getAs( void *oSample,
                 const ISampleSelector &iSS = ISampleSelector() );
 
+    //! Read a sample straight into oBuffer, memory owned by the caller,
+    //! without an intermediate ArraySample.  iCapacity is the number of
+    //! elements (not PODs) oBuffer can hold, it must be at least the
+    //! number of points in the sample, which is what is returned.
+    size_t getInto( void *oBuffer, size_t iCapacity,
+                    const ISampleSelector &iSS = ISampleSelector() ) const;
+
     //! Get a key from an address of a datum.
     //! ...
     bool getKey( AbcA::ArraySampleKey& oKey,
@@ -474,6 +474,22 @@ std::string IObject::instanceSourcePath()
     return std::string();
 }
 
+//-*****************************************************************************
+std::string IObject::getInstanceGroup() const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IObject::getInstanceGroup()" );
+
+    if ( m_object )
+    {
+        // m_object is the source reader for instances and their descendants
+        return m_object->getFullName();
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return std::string();
+}
+
 //-*****************************************************************************
 void IObject::setInstancedFullName( const std::string& parentPath ) const
 {
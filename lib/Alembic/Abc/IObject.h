@@ -212,6 +212,13 @@ public:
     //! that the instance points at.  Otherwise and empty string is returned.
     std::string instanceSourcePath();
 
+    //! Returns an id shared by every object whose data is read from the same
+    //! source object, no matter how many instances it is reached through.
+    //! It is the full name of that source object, so for objects which are
+    //! not instance descendants it is simply getFullName().  Consumers can
+    //! emit one prototype per group and place the rest with transforms.
+    std::string getInstanceGroup() const;
+
     bool isChildInstance(size_t iChildIndex) const;
     bool isChildInstance(const std::string &iChildName) const;
 
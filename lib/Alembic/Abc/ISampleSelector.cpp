@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/Abc/ISampleSelector.h>
+#include <Alembic/Abc/SampleIndexCache.h>
 
 namespace Alembic {
 namespace Abc {
@@ -67,6 +68,31 @@ index_t ISampleSelector::getIndex( const AbcA::TimeSamplingPtr & iTsmp,
     return retIdx < 0 ? 0 : ( retIdx < iNumSamples ? retIdx : iNumSamples-1 );
 }
 
+//-*****************************************************************************
+index_t ISampleSelector::getIndex( AbcA::BasePropertyReader & iProperty,
+    index_t iNumSamples ) const
+{
+    const AbcA::TimeSamplingPtr & tsmp =
+        iProperty.getHeader().getTimeSampling();
+
+    // only worth finding the archive for what the cache would hold
+    if ( m_requestedIndex >= 0 || iNumSamples < 2 ||
+         !tsmp->getTimeSamplingType().isAcyclic() )
+    {
+        return getIndex( tsmp, iNumSamples );
+    }
+
+    SampleIndexCachePtr cache =
+        SampleIndexCache::find( iProperty.getObject()->getArchive().get() );
+
+    if ( !cache )
+    {
+        return getIndex( tsmp, iNumSamples );
+    }
+
+    return cache->getIndex( *this, tsmp, iNumSamples );
+}
+
 
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Abc
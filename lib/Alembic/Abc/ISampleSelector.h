@@ -79,6 +79,12 @@ public:
     index_t getIndex( const AbcA::TimeSamplingPtr & iTsmp, index_t
         iNumSamples ) const;
 
+    //! The index of the sample of iProperty, which has iNumSamples samples.
+    //! The lookup goes through the SampleIndexCache of the property's
+    //! archive, if it has one.
+    index_t getIndex( AbcA::BasePropertyReader & iProperty,
+                      index_t iNumSamples ) const;
+
 private:
     index_t m_requestedIndex;
     chrono_t m_requestedTime;
@@ -91,7 +91,7 @@ void IScalarProperty::get( void *oSamp, const ISampleSelector &iSS ) const
 {
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "IScalarProperty::get()" );
 
-    AbcA::index_t index = iSS.getIndex( m_property->getTimeSampling(),
+    AbcA::index_t index = iSS.getIndex( *m_property,
                                         m_property->getNumSamples() );
     m_property->getSample( index, oSamp );
 
@@ -143,6 +143,41 @@ public:
                                                   AbcA::ArraySample>( ptr );
     }
 
+    //! Get a typed sample holding only iNumElements elements starting at
+    //! iElementOffset.
+    void getRange( sample_ptr_type& iVal,
+                   size_t iElementOffset,
+                   size_t iNumElements,
+                   const ISampleSelector &iSS = ISampleSelector() ) const
+    {
+        AbcA::ArraySamplePtr ptr;
+        IArrayProperty::getRange( ptr, iElementOffset, iNumElements, iSS );
+        iVal = Alembic::Util::static_pointer_cast<sample_type,
+                                                  AbcA::ArraySample>( ptr );
+    }
+
+    //! Read the sample straight into oBuffer, which has room for iCapacity
+    //! values, for example the vertex buffer of a renderer.  Returns the
+    //! number of values read.
+    size_t getInto( value_type *oBuffer, size_t iCapacity,
+                    const ISampleSelector &iSS = ISampleSelector() ) const
+    {
+        return IArrayProperty::getInto( oBuffer, iCapacity, iSS );
+    }
+
+    //! Read the sample straight into oVec, resizing it to fit.
+    void getInto( std::vector<value_type> &oVec,
+                  const ISampleSelector &iSS = ISampleSelector() ) const
+    {
+        Util::Dimensions dims;
+        getDimensions( dims, iSS );
+        oVec.resize( dims.numPoints() );
+        if ( !oVec.empty() )
+        {
+            getInto( &oVec.front(), oVec.size(), iSS );
+        }
+    }
+
     //! Return the typed sample by value.
     //! ...
     sample_ptr_type getValue( const ISampleSelector &iSS = ISampleSelector() ) const
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/Abc/OArrayProperty.h>
+#include <Alembic/Abc/IArrayProperty.h>
 
 namespace Alembic {
 namespace Abc {
@@ -79,6 +80,22 @@ void OArrayProperty::setFromPrevious()
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OArrayProperty::setFrom( const IArrayProperty & iSource,
+                              const ISampleSelector &iSS )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::setFrom()" );
+
+    AbcA::ArrayPropertyReaderPtr reader = iSource.getPtr();
+    ABCA_ASSERT( reader, "Invalid source IArrayProperty" );
+
+    index_t index = iSS.getIndex( reader->getTimeSampling(),
+                                  reader->getNumSamples() );
+    m_property->setSampleFrom( reader, index );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OArrayProperty::setTimeSampling( uint32_t iIndex )
 {
@@ -42,11 +42,14 @@
 #include <Alembic/Abc/Argument.h>
 #include <Alembic/Abc/OBaseProperty.h>
 #include <Alembic/Abc/OCompoundProperty.h>
+#include <Alembic/Abc/ISampleSelector.h>
 
 namespace Alembic {
 namespace Abc {
 namespace ALEMBIC_VERSION_NS {
 
+class IArrayProperty;
+
 //-*****************************************************************************
 class ALEMBIC_EXPORT OArrayProperty
     : public OBasePropertyT<AbcA::ArrayPropertyWriterPtr>
@@ -122,6 +125,14 @@ public:
     //! ...
     void setFromPrevious( );
 
+    //! Set a sample from a sample of iSource, which must have the same
+    //! DataType.  Between Ogawa archives the stored data and its key are
+    //! transferred as they are, without decoding or hashing them again, and
+    //! data which this archive already has isn't even read.  This makes
+    //! re-exporting the unchanged parts of a previous archive cheap.
+    void setFrom( const IArrayProperty & iSource,
+                  const ISampleSelector &iSS = ISampleSelector() );
+
     //! Changes the TimeSampling used by this property.
     //! If the TimeSampling is changed to Acyclic and the number of samples
     //! currently set is more than the number of times provided in the Acyclic
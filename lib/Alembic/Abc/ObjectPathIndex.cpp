@@ -0,0 +1,172 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/ObjectPathIndex.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+const size_t ObjectPathIndex::kDefaultMaxSize = 1 << 16;
+
+//-*****************************************************************************
+ObjectPathIndex::ObjectPathIndex( size_t iMaxSize )
+    : m_maxSize( iMaxSize )
+{
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr
+ObjectPathIndex::find( AbcA::ArchiveReaderPtr iArchive,
+                       const std::string &iFullName )
+{
+    // build the canonical "/a/b/c" form of the name and of each ancestor,
+    // dropping any empty components so that "a/b/" and "/a//b" end up
+    // under the same key, the top object is ""
+    std::vector< std::string > fullNames( 1 );
+    std::vector< std::string > names( 1 );
+    std::size_t curPos = 0;
+    while ( curPos < iFullName.size() )
+    {
+        std::size_t nextSlash = iFullName.find( '/', curPos );
+        if ( nextSlash == std::string::npos )
+        {
+            nextSlash = iFullName.size();
+        }
+
+        if ( nextSlash > curPos )
+        {
+            names.push_back( iFullName.substr( curPos, nextSlash - curPos ) );
+            fullNames.push_back( fullNames.back() + "/" + names.back() );
+        }
+
+        curPos = nextSlash + 1;
+    }
+
+    std::size_t depth = fullNames.size() - 1;
+    if ( depth == 0 )
+    {
+        return iArchive->getTop();
+    }
+
+    // find the object, or the deepest ancestor of it that is still alive
+    AbcA::ObjectReaderPtr obj;
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        for ( ; depth > 0; --depth )
+        {
+            IndexMap::iterator it = m_index.find( fullNames[depth] );
+            if ( it != m_index.end() )
+            {
+                obj = it->second.lock();
+                if ( obj )
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if ( !obj )
+    {
+        obj = iArchive->getTop();
+    }
+
+    // walk the rest of the way without holding the lock, getChild can be
+    // expensive the first time a child is touched
+    for ( ++depth; obj && depth < fullNames.size(); ++depth )
+    {
+        if ( !obj->getChildHeader( names[depth] ) )
+        {
+            return AbcA::ObjectReaderPtr();
+        }
+
+        obj = obj->getChild( names[depth] );
+        if ( obj )
+        {
+            add( fullNames[depth], obj );
+        }
+    }
+
+    return obj;
+}
+
+//-*****************************************************************************
+void ObjectPathIndex::add( const std::string &iFullName,
+                           AbcA::ObjectReaderPtr iObject )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+
+    if ( m_index.size() >= m_maxSize && m_index.count( iFullName ) == 0 )
+    {
+        for ( IndexMap::iterator it = m_index.begin(); it != m_index.end(); )
+        {
+            if ( it->second.expired() )
+            {
+                it = m_index.erase( it );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if ( m_index.size() >= m_maxSize )
+        {
+            m_index.clear();
+        }
+    }
+
+    m_index[iFullName] = iObject;
+}
+
+//-*****************************************************************************
+size_t ObjectPathIndex::size()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_index.size();
+}
+
+//-*****************************************************************************
+void ObjectPathIndex::clear()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_index.clear();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,96 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_ObjectPathIndex_h_
+#define _Alembic_Abc_ObjectPathIndex_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+class ObjectPathIndex;
+typedef Alembic::Util::shared_ptr< ObjectPathIndex > ObjectPathIndexPtr;
+
+//-*****************************************************************************
+//! The index IArchive::findObject keeps of the objects it has found, by full
+//! name.  Only the objects on the paths that were looked up are in it, and
+//! the readers are held weakly, since they hold on to their archive.
+//! A lookup starts from the deepest object on its path whose reader is still
+//! alive and walks down by name from there.
+//!
+//! Once there are more than the maximum number of names in it, the names
+//! whose readers have gone away are dropped, and if that isn't enough the
+//! whole index is.
+class ALEMBIC_EXPORT ObjectPathIndex : private Alembic::Util::noncopyable
+{
+public:
+    static const size_t kDefaultMaxSize;
+
+    explicit ObjectPathIndex( size_t iMaxSize = kDefaultMaxSize );
+
+    //! Returns the reader of the object of iArchive with the full name
+    //! iFullName, for example "/a/b/c".  "/" (or an empty string) is the top
+    //! object.  A NULL pointer is returned if there is no such object.
+    AbcA::ObjectReaderPtr find( AbcA::ArchiveReaderPtr iArchive,
+                                const std::string &iFullName );
+
+    size_t size();
+
+    void clear();
+
+private:
+    typedef Alembic::Util::unordered_map< std::string,
+        Alembic::Util::weak_ptr< AbcA::ObjectReader > > IndexMap;
+
+    void add( const std::string &iFullName, AbcA::ObjectReaderPtr iObject );
+
+    size_t m_maxSize;
+
+    Alembic::Util::mutex m_lock;
+    IndexMap m_index;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
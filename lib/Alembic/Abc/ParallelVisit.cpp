@@ -0,0 +1,329 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/ParallelVisit.h>
+
+#include <Alembic/Util/Threads.h>
+
+#include <deque>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ParallelVisitor::~ParallelVisitor()
+{
+}
+
+//-*****************************************************************************
+void ParallelVisitor::visitProperty( ICompoundProperty & iParent,
+                                     const AbcA::PropertyHeader & iHeader,
+                                     std::size_t iWorker )
+{
+}
+
+namespace { // anonymous
+
+//-*****************************************************************************
+// A child of an object that still needs to be visited, the child reader is
+// created by whichever worker ends up with the task, which keeps objects
+// with very many children from being expanded by a single thread.
+struct VisitTask
+{
+    VisitTask() : index( 0 ) {}
+
+    VisitTask( const IObject & iParent, std::size_t iIndex )
+      : parent( iParent ), index( iIndex ) {}
+
+    IObject parent;
+    std::size_t index;
+};
+
+//-*****************************************************************************
+struct VisitQueue
+{
+    Util::mutex lock;
+    std::deque< VisitTask > tasks;
+};
+
+//-*****************************************************************************
+class VisitState : Util::noncopyable
+{
+public:
+    VisitState( ParallelVisitor & iVisitor,
+                const ParallelVisitOptions & iOptions,
+                std::size_t iNumThreads )
+      : visitor( iVisitor )
+      , visitProperties( iOptions.visitProperties )
+      , numThreads( iNumThreads )
+      , queues( new VisitQueue[iNumThreads] )
+      , pending( 0 )
+      , pushes( 0 )
+      , aborted( false )
+    {}
+
+    ~VisitState()
+    {
+        delete [] queues;
+    }
+
+    ParallelVisitor & visitor;
+    bool visitProperties;
+    std::size_t numThreads;
+    VisitQueue * queues;
+
+    // number of tasks queued or in flight and how many times tasks have
+    // been queued, guarded by lock which idle workers wait on
+    Util::condition_mutex lock;
+    std::size_t pending;
+    std::size_t pushes;
+    bool aborted;
+    std::string error;
+};
+
+//-*****************************************************************************
+// our own tasks come off the back so that each worker goes depth first,
+// stolen tasks come off the front where the larger subtrees tend to be
+bool popTask( VisitState & iState, std::size_t iWorker, VisitTask & oTask )
+{
+    {
+        VisitQueue & queue = iState.queues[iWorker];
+        Util::scoped_lock l( queue.lock );
+        if ( !queue.tasks.empty() )
+        {
+            oTask = queue.tasks.back();
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for ( std::size_t i = 1; i < iState.numThreads; ++i )
+    {
+        VisitQueue & queue = iState.queues[( iWorker + i ) % iState.numThreads];
+        Util::scoped_lock l( queue.lock );
+        if ( !queue.tasks.empty() )
+        {
+            oTask = queue.tasks.front();
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-*****************************************************************************
+void visitProperties( VisitState & iState, ICompoundProperty & iParent,
+                      std::size_t iWorker )
+{
+    std::size_t numProps = iParent.getNumProperties();
+    for ( std::size_t i = 0; i < numProps; ++i )
+    {
+        const AbcA::PropertyHeader & header = iParent.getPropertyHeader( i );
+        iState.visitor.visitProperty( iParent, header, iWorker );
+
+        if ( header.isCompound() )
+        {
+            ICompoundProperty child( iParent, header.getName() );
+            visitProperties( iState, child, iWorker );
+        }
+    }
+}
+
+//-*****************************************************************************
+void visitObject( VisitState & iState, IObject & iObject,
+                  std::size_t iWorker )
+{
+    if ( !iState.visitor.visitObject( iObject, iWorker ) )
+    {
+        return;
+    }
+
+    std::size_t numChildren = iObject.getNumChildren();
+    if ( numChildren > 0 )
+    {
+        {
+            Util::scoped_condition_lock l( iState.lock );
+            iState.pending += numChildren;
+        }
+
+        // pushed in reverse so that they are popped back off in order
+        {
+            VisitQueue & queue = iState.queues[iWorker];
+            Util::scoped_lock l( queue.lock );
+            for ( std::size_t i = numChildren; i > 0; --i )
+            {
+                queue.tasks.push_back( VisitTask( iObject, i - 1 ) );
+            }
+        }
+
+        // let any idle workers know there is something to take
+        Util::scoped_condition_lock l( iState.lock );
+        ++iState.pushes;
+        iState.lock.notify_all();
+    }
+
+    if ( iState.visitProperties )
+    {
+        ICompoundProperty props = iObject.getProperties();
+        visitProperties( iState, props, iWorker );
+    }
+}
+
+//-*****************************************************************************
+void runWorker( VisitState & iState, std::size_t iWorker )
+{
+    VisitTask task;
+    for ( ;; )
+    {
+        std::size_t pushes = 0;
+        {
+            Util::scoped_condition_lock l( iState.lock );
+            pushes = iState.pushes;
+        }
+
+        if ( !popTask( iState, iWorker, task ) )
+        {
+            // sleep until more tasks get queued, or there is no more work
+            // at all, tasks queued since we looked are caught by pushes
+            Util::scoped_condition_lock l( iState.lock );
+            while ( iState.pending > 0 && !iState.aborted &&
+                    iState.pushes == pushes )
+            {
+                iState.lock.wait();
+            }
+
+            if ( iState.pending == 0 || iState.aborted )
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        bool aborted = false;
+        {
+            Util::scoped_condition_lock l( iState.lock );
+            aborted = iState.aborted;
+        }
+
+        if ( !aborted )
+        {
+            try
+            {
+                IObject obj = task.parent.getChild( task.index );
+                visitObject( iState, obj, iWorker );
+            }
+            catch ( std::exception & e )
+            {
+                Util::scoped_condition_lock l( iState.lock );
+                if ( !iState.aborted )
+                {
+                    iState.aborted = true;
+                    iState.error = e.what();
+                    iState.lock.notify_all();
+                }
+            }
+            catch ( ... )
+            {
+                Util::scoped_condition_lock l( iState.lock );
+                if ( !iState.aborted )
+                {
+                    iState.aborted = true;
+                    iState.error = "Unknown exception";
+                    iState.lock.notify_all();
+                }
+            }
+        }
+
+        // release our hold on the parent before saying we are done
+        task = VisitTask();
+
+        Util::scoped_condition_lock l( iState.lock );
+        if ( --iState.pending == 0 )
+        {
+            iState.lock.notify_all();
+        }
+    }
+}
+
+//-*****************************************************************************
+void workerEntry( std::size_t iWorker, void * iState )
+{
+    runWorker( *static_cast< VisitState * >( iState ), iWorker );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+std::size_t GetParallelVisitNumThreads( const ParallelVisitOptions & iOptions )
+{
+    if ( iOptions.numThreads > 0 )
+    {
+        return iOptions.numThreads;
+    }
+
+    return Util::GetNumProcessors();
+}
+
+//-*****************************************************************************
+void ParallelVisit( IObject iRoot,
+                    ParallelVisitor & iVisitor,
+                    const ParallelVisitOptions & iOptions )
+{
+    if ( !iRoot.valid() )
+    {
+        return;
+    }
+
+    std::size_t numThreads = GetParallelVisitNumThreads( iOptions );
+    VisitState state( iVisitor, iOptions, numThreads );
+
+    // the root is visited here, which also seeds the first queue
+    visitObject( state, iRoot, 0 );
+
+    Util::RunThreads( numThreads, workerEntry, &state );
+
+    if ( state.aborted )
+    {
+        ABCA_THROW( state.error );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,120 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_ParallelVisit_h_
+#define _Alembic_Abc_ParallelVisit_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/ICompoundProperty.h>
+#include <Alembic/Abc/IObject.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The callbacks made by ParallelVisit.  They are made concurrently from
+//! several threads, iWorker (in the range [0, number of threads)) identifies
+//! the calling thread so that per worker state can be kept without locking.
+class ALEMBIC_EXPORT ParallelVisitor
+{
+public:
+    virtual ~ParallelVisitor();
+
+    //! Called once for every object that is reached, starting with the root.
+    //! Return false to skip everything below iObject.
+    virtual bool visitObject( IObject & iObject, std::size_t iWorker ) = 0;
+
+    //! Called for each property of a visited object if
+    //! ParallelVisitOptions::visitProperties is set, compound properties
+    //! are followed down.  This is called on the same worker that visited
+    //! the object, after its children have been made available to the
+    //! other workers.
+    virtual void visitProperty( ICompoundProperty & iParent,
+                                const AbcA::PropertyHeader & iHeader,
+                                std::size_t iWorker );
+};
+
+//-*****************************************************************************
+struct ParallelVisitOptions
+{
+    ParallelVisitOptions()
+      : numThreads( 0 )
+      , visitProperties( false )
+    {}
+
+    //! The number of threads to visit with, including the calling thread.
+    //! 0 uses one per processor.
+    std::size_t numThreads;
+
+    //! Whether ParallelVisitor::visitProperty is called.
+    bool visitProperties;
+};
+
+//-*****************************************************************************
+//! Returns the number of workers ParallelVisit will use for these options,
+//! handy for sizing per worker state up front.
+ALEMBIC_EXPORT std::size_t
+GetParallelVisitNumThreads( const ParallelVisitOptions & iOptions );
+
+//-*****************************************************************************
+//! Visits iRoot and everything below it using a pool of threads.  Each
+//! worker keeps its own queue of objects, working depth first on what it
+//! found itself and taking breadth first from the others when it runs dry.
+//! There is no ordering between siblings or between different subtrees,
+//! only a parent is guaranteed to be visited before its children.
+//!
+//! Ogawa archives hand out a stream per read, so an archive opened with
+//! fewer streams than there are workers will serialize some of the reads.
+//!
+//! If a callback throws, the remaining work is abandoned and an exception
+//! carrying the same message is thrown from here once all of the workers
+//! have stopped.
+ALEMBIC_EXPORT void
+ParallelVisit( IObject iRoot,
+               ParallelVisitor & iVisitor,
+               const ParallelVisitOptions & iOptions =
+                   ParallelVisitOptions() );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,202 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/SampleIndexCache.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// past this many the cache is emptied, a single frame of a scene doesn't
+// come anywhere near it
+static const size_t kMaxCachedIndices = 1 << 16;
+
+typedef std::map< const AbcA::ArchiveReader *,
+                  Alembic::Util::weak_ptr< SampleIndexCache > > CacheMap;
+
+// the caches of every archive that has one, so a property can find the one
+// of its archive
+Alembic::Util::mutex g_cachesLock;
+CacheMap g_caches;
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+bool SampleIndexCache::Key::operator<( const Key & iRhs ) const
+{
+    if ( timeSampling != iRhs.timeSampling )
+    {
+        return timeSampling < iRhs.timeSampling;
+    }
+
+    if ( numSamples != iRhs.numSamples )
+    {
+        return numSamples < iRhs.numSamples;
+    }
+
+    if ( time != iRhs.time )
+    {
+        return time < iRhs.time;
+    }
+
+    return indexType < iRhs.indexType;
+}
+
+//-*****************************************************************************
+SampleIndexCachePtr SampleIndexCache::get( AbcA::ArchiveReaderPtr iArchive )
+{
+    if ( !iArchive )
+    {
+        return SampleIndexCachePtr();
+    }
+
+    Alembic::Util::scoped_lock l( g_cachesLock );
+
+    Alembic::Util::weak_ptr< SampleIndexCache > & entry =
+        g_caches[iArchive.get()];
+
+    SampleIndexCachePtr ret = entry.lock();
+    if ( !ret )
+    {
+        ret.reset( new SampleIndexCache( iArchive ) );
+        entry = ret;
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+SampleIndexCachePtr
+SampleIndexCache::find( const AbcA::ArchiveReader * iArchive )
+{
+    Alembic::Util::scoped_lock l( g_cachesLock );
+
+    CacheMap::iterator it = g_caches.find( iArchive );
+    if ( it == g_caches.end() )
+    {
+        return SampleIndexCachePtr();
+    }
+
+    return it->second.lock();
+}
+
+//-*****************************************************************************
+SampleIndexCache::SampleIndexCache( AbcA::ArchiveReaderPtr iArchive )
+    : m_archive( iArchive )
+{
+    uint32_t numSamplings = m_archive->getNumTimeSamplings();
+    for ( uint32_t i = 0; i < numSamplings; ++i )
+    {
+        m_timeSamplings[m_archive->getTimeSampling( i ).get()] = i;
+    }
+}
+
+//-*****************************************************************************
+SampleIndexCache::~SampleIndexCache()
+{
+    // m_archive is still alive, so no other archive can have taken its
+    // address, but a new cache may already have replaced this one
+    Alembic::Util::scoped_lock l( g_cachesLock );
+
+    CacheMap::iterator it = g_caches.find( m_archive.get() );
+    if ( it != g_caches.end() && it->second.expired() )
+    {
+        g_caches.erase( it );
+    }
+}
+
+//-*****************************************************************************
+index_t SampleIndexCache::getIndex( const ISampleSelector & iSS,
+                                    const AbcA::TimeSamplingPtr & iTsmp,
+                                    index_t iNumSamples )
+{
+    std::map< const AbcA::TimeSampling *, uint32_t >::const_iterator ts =
+        m_timeSamplings.find( iTsmp.get() );
+
+    if ( iSS.getRequestedIndex() >= 0 || ts == m_timeSamplings.end() ||
+         !iTsmp->getTimeSamplingType().isAcyclic() )
+    {
+        return iSS.getIndex( iTsmp, iNumSamples );
+    }
+
+    Key key;
+    key.timeSampling = ts->second;
+    key.numSamples = iNumSamples;
+    key.time = iSS.getRequestedTime();
+    key.indexType = iSS.getRequestedTimeIndexType();
+
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        std::map< Key, index_t >::const_iterator it = m_indices.find( key );
+        if ( it != m_indices.end() )
+        {
+            return it->second;
+        }
+    }
+
+    // solved outside of the lock, another thread may get here first with
+    // the same key but it can only come up with the same index
+    index_t index = iSS.getIndex( iTsmp, iNumSamples );
+
+    Alembic::Util::scoped_lock l( m_lock );
+    if ( m_indices.size() >= kMaxCachedIndices )
+    {
+        m_indices.clear();
+    }
+    m_indices[key] = index;
+
+    return index;
+}
+
+//-*****************************************************************************
+size_t SampleIndexCache::size()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_indices.size();
+}
+
+//-*****************************************************************************
+void SampleIndexCache::clear()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_indices.clear();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,113 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_SampleIndexCache_h_
+#define _Alembic_Abc_SampleIndexCache_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/ISampleSelector.h>
+
+#include <map>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+class SampleIndexCache;
+typedef Alembic::Util::shared_ptr< SampleIndexCache > SampleIndexCachePtr;
+
+//-*****************************************************************************
+//! Remembers the sample indices that time based ISampleSelectors resolved
+//! to in one archive, keyed by the time sampling index, the number of
+//! samples, the requested time and the index type.  Reading thousands of
+//! properties at the same time then looks each distinct combination up once.
+//!
+//! Every IArchive opened on an archive shares the same cache, and
+//! ISampleSelector::getIndex consults it for the properties of that archive
+//! for as long as one of those IArchives is around.  Only acyclic time
+//! samplings are cached, uniform and cyclic ones are solved directly.
+class ALEMBIC_EXPORT SampleIndexCache : private Alembic::Util::noncopyable
+{
+public:
+    //! Returns the cache of iArchive, creating it if there isn't one yet.
+    static SampleIndexCachePtr get( AbcA::ArchiveReaderPtr iArchive );
+
+    //! Returns the cache of iArchive, or NULL if it doesn't have one.
+    static SampleIndexCachePtr find( const AbcA::ArchiveReader * iArchive );
+
+    ~SampleIndexCache();
+
+    //! Resolves iSS against iTsmp and iNumSamples, which must belong to the
+    //! archive of this cache, like ISampleSelector::getIndex does.
+    index_t getIndex( const ISampleSelector & iSS,
+                      const AbcA::TimeSamplingPtr & iTsmp,
+                      index_t iNumSamples );
+
+    size_t size();
+
+    void clear();
+
+private:
+    explicit SampleIndexCache( AbcA::ArchiveReaderPtr iArchive );
+
+    struct Key
+    {
+        uint32_t timeSampling;
+        index_t numSamples;
+        chrono_t time;
+        ISampleSelector::TimeIndexType indexType;
+
+        bool operator<( const Key & iRhs ) const;
+    };
+
+    AbcA::ArchiveReaderPtr m_archive;
+
+    // the time samplings of the archive, to their index
+    std::map< const AbcA::TimeSampling *, uint32_t > m_timeSamplings;
+
+    Alembic::Util::mutex m_lock;
+    std::map< Key, index_t > m_indices;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,165 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+using Alembic::Util::int32_t;
+using Alembic::Util::float32_t;
+
+//-*****************************************************************************
+void writeProp( OObject & iParent, const std::string & iName, float iVal )
+{
+    OObject prop( iParent, iName );
+    OObject geo( prop, "geo" );
+
+    AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+    OFloatArrayProperty pts( geo.getProperties(), "P", ts );
+    OInt32Property id( geo.getProperties(), "id" );
+    std::vector< float32_t > vals( 30, iVal );
+    for ( int i = 0; i < 3; ++i )
+    {
+        vals[0] = i;
+        pts.set( FloatArraySample( vals ) );
+    }
+    id.set( 7 );
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    OObject top = archive.getTop();
+
+    /*
+        set
+         /  |   \     \
+       a    b    c     d     (a, b and c are the same, d differs)
+       |    |    |     |
+      geo  geo  geo   geo
+    */
+    OObject set( top, "set" );
+    writeProp( set, "a", 1.0f );
+    writeProp( set, "b", 1.0f );
+    writeProp( set, "c", 1.0f );
+    writeProp( set, "d", 2.0f );
+
+    // empty objects are never instanced
+    OObject( top, "empty0" );
+    OObject( top, "empty1" );
+}
+
+//-*****************************************************************************
+void checkProp( IObject iObj, float iVal )
+{
+    IObject geo = iObj.getChild( "geo" );
+    TESTING_ASSERT( geo.valid() );
+
+    IFloatArrayProperty pts( geo.getProperties(), "P" );
+    TESTING_ASSERT( pts.getNumSamples() == 3 );
+    TESTING_ASSERT( pts.getTimeSampling()->getTimeSamplingType().
+                    getTimePerCycle() == 1.0 / 24.0 );
+
+    FloatArraySamplePtr samp = pts.getValue( ISampleSelector( ( index_t ) 2 ) );
+    TESTING_ASSERT( samp->size() == 30 );
+    TESTING_ASSERT( (*samp)[0] == 2.0f );
+    TESTING_ASSERT( (*samp)[29] == iVal );
+
+    IInt32Property id( geo.getProperties(), "id" );
+    TESTING_ASSERT( id.getValue() == 7 );
+}
+
+//-*****************************************************************************
+void copyTest( const std::string & iInName, const std::string & iOutName,
+               bool iInstanceDuplicates )
+{
+    std::size_t numInstanced = 0;
+    {
+        IArchive in( Alembic::AbcCoreOgawa::ReadArchive(), iInName );
+        OArchive out( Alembic::AbcCoreOgawa::WriteArchive(), iOutName,
+                      in.getTop().getMetaData() );
+
+        CopyArchiveOptions options;
+        options.instanceDuplicates = iInstanceDuplicates;
+        numInstanced = CopyArchive( in, out, options );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iOutName );
+    IObject set = archive.getTop().getChild( "set" );
+    TESTING_ASSERT( set.getNumChildren() == 4 );
+    TESTING_ASSERT( archive.getTop().getNumChildren() == 3 );
+
+    checkProp( set.getChild( "a" ), 1.0f );
+    checkProp( set.getChild( "b" ), 1.0f );
+    checkProp( set.getChild( "c" ), 1.0f );
+    checkProp( set.getChild( "d" ), 2.0f );
+
+    TESTING_ASSERT( !set.getChild( "a" ).isInstanceRoot() );
+    TESTING_ASSERT( !set.getChild( "d" ).isInstanceRoot() );
+    TESTING_ASSERT( !archive.getTop().getChild( "empty1" ).isInstanceRoot() );
+
+    if ( iInstanceDuplicates )
+    {
+        TESTING_ASSERT( numInstanced == 2 );
+        TESTING_ASSERT( set.getChild( "b" ).isInstanceRoot() );
+        TESTING_ASSERT( set.getChild( "c" ).isInstanceRoot() );
+        TESTING_ASSERT( set.getChild( "c" ).instanceSourcePath() ==
+                        "/set/a" );
+        TESTING_ASSERT( set.getChild( "b" ).getChild( "geo" ).
+                        getInstanceGroup() == "/set/a/geo" );
+    }
+    else
+    {
+        TESTING_ASSERT( numInstanced == 0 );
+        TESTING_ASSERT( !set.getChild( "b" ).isInstanceRoot() );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    writeArchive( "archiveCopyIn.abc" );
+    copyTest( "archiveCopyIn.abc", "archiveCopyFull.abc", false );
+    copyTest( "archiveCopyIn.abc", "archiveCopyInstanced.abc", true );
+
+    // copying the instanced archive again keeps the instances
+    copyTest( "archiveCopyInstanced.abc", "archiveCopyAgain.abc", true );
+    return 0;
+}
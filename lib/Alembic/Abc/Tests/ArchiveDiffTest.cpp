@@ -0,0 +1,214 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+using Alembic::Util::float32_t;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName, bool iChanged )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    OObject top = archive.getTop();
+
+    /*
+        a   b   c   g      (changed: a/P sample 1 differs, a gets "extra",
+                |   |       b/name differs, c/d is replaced by c/e,
+                d   h       f is added, g is untouched)
+    */
+    OObject a( top, "a" );
+    OFloatArrayProperty pts( a.getProperties(), "P" );
+    OInt32Property id( a.getProperties(), "id" );
+    std::vector< float32_t > vals( 10, 1.0f );
+    for ( int i = 0; i < 3; ++i )
+    {
+        vals[0] = ( iChanged && i == 1 ) ? 100.0f : i;
+        pts.set( FloatArraySample( vals ) );
+        id.set( i );
+    }
+
+    if ( iChanged )
+    {
+        OBoolProperty extra( a.getProperties(), "extra" );
+        extra.set( true );
+    }
+
+    OObject b( top, "b" );
+    OCompoundProperty user( b.getProperties(), "user" );
+    OStringProperty name( user, "name" );
+    name.set( iChanged ? "after" : "before" );
+
+    OObject c( top, "c" );
+    OObject( c, iChanged ? "e" : "d" );
+
+    OObject g( top, "g" );
+    OObject h( g, "h" );
+    OFloatArrayProperty hpts( h.getProperties(), "P" );
+    hpts.set( FloatArraySample( vals ) );
+
+    if ( iChanged )
+    {
+        OObject( top, "f" );
+    }
+}
+
+//-*****************************************************************************
+// P differs at samples 0 and 10, id at samples 3, 4 and 8
+void writeRunsArchive( const std::string & iArchiveName, bool iChanged )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    OObject a( archive.getTop(), "a" );
+    OFloatArrayProperty pts( a.getProperties(), "P" );
+    OInt32Property id( a.getProperties(), "id" );
+    std::vector< float32_t > vals( 10, 1.0f );
+    for ( int i = 0; i < 12; ++i )
+    {
+        vals[0] = ( iChanged && ( i == 0 || i == 10 ) ) ? 100.0f : i;
+        pts.set( FloatArraySample( vals ) );
+        id.set( ( iChanged && ( i == 3 || i == 4 || i == 8 ) ) ? -i : i );
+    }
+}
+
+//-*****************************************************************************
+bool hasDiff( const std::vector< ArchiveDifference > & iDiffs,
+              ArchiveDifference::Kind iKind,
+              const std::string & iObject,
+              const std::string & iProperty = std::string() )
+{
+    for ( std::size_t i = 0; i < iDiffs.size(); ++i )
+    {
+        if ( iDiffs[i].kind == iKind && iDiffs[i].objectPath == iObject &&
+             iDiffs[i].propertyPath == iProperty )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    writeArchive( "archiveDiffA.abc", false );
+    writeArchive( "archiveDiffB.abc", true );
+
+    {
+        IArchive in( Alembic::AbcCoreOgawa::ReadArchive(), "archiveDiffA.abc" );
+        OArchive out( Alembic::AbcCoreOgawa::WriteArchive(),
+                      "archiveDiffCopy.abc" );
+        CopyArchive( in, out );
+    }
+
+    IArchive a( Alembic::AbcCoreOgawa::ReadArchive(), "archiveDiffA.abc" );
+    IArchive b( Alembic::AbcCoreOgawa::ReadArchive(), "archiveDiffB.abc" );
+    IArchive copy( Alembic::AbcCoreOgawa::ReadArchive(),
+                   "archiveDiffCopy.abc" );
+
+    std::vector< ArchiveDifference > diffs;
+    TESTING_ASSERT( DiffArchives( a, copy, diffs ) );
+    TESTING_ASSERT( DiffArchives( a, a, diffs ) );
+    TESTING_ASSERT( diffs.empty() );
+
+    TESTING_ASSERT( !DiffArchives( a, b, diffs ) );
+    TESTING_ASSERT( diffs.size() == 6 );
+
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kSamplesChanged,
+                             "/a", "P" ) );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kPropertyAdded,
+                             "/a", "extra" ) );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kSamplesChanged,
+                             "/b", "user/name" ) );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kObjectRemoved,
+                             "/c/d" ) );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kObjectAdded,
+                             "/c/e" ) );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kObjectAdded, "/f" ) );
+
+    // only sample 1 of P differs
+    TESTING_ASSERT( diffs[0].objectPath == "/a" );
+    TESTING_ASSERT( diffs[0].firstSample == 1 );
+    TESTING_ASSERT( diffs[0].numSamples == 1 );
+
+    // and the other way around
+    diffs.clear();
+    TESTING_ASSERT( !DiffArchives( b, a, diffs ) );
+    TESTING_ASSERT( diffs.size() == 6 );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kPropertyRemoved,
+                             "/a", "extra" ) );
+    TESTING_ASSERT( hasDiff( diffs, ArchiveDifference::kObjectRemoved, "/f" ) );
+
+    // every run of consecutive changed samples is its own difference
+    writeRunsArchive( "archiveDiffRunsA.abc", false );
+    writeRunsArchive( "archiveDiffRunsB.abc", true );
+    IArchive runsA( Alembic::AbcCoreOgawa::ReadArchive(),
+                    "archiveDiffRunsA.abc" );
+    IArchive runsB( Alembic::AbcCoreOgawa::ReadArchive(),
+                    "archiveDiffRunsB.abc" );
+
+    diffs.clear();
+    TESTING_ASSERT( !DiffArchives( runsA, runsB, diffs ) );
+    TESTING_ASSERT( diffs.size() == 4 );
+
+    std::vector< ArchiveDifference > pts, ids;
+    for ( std::size_t i = 0; i < diffs.size(); ++i )
+    {
+        TESTING_ASSERT( diffs[i].kind == ArchiveDifference::kSamplesChanged );
+        TESTING_ASSERT( diffs[i].objectPath == "/a" );
+        if ( diffs[i].propertyPath == "P" )
+        {
+            pts.push_back( diffs[i] );
+        }
+        else if ( diffs[i].propertyPath == "id" )
+        {
+            ids.push_back( diffs[i] );
+        }
+    }
+
+    TESTING_ASSERT( pts.size() == 2 );
+    TESTING_ASSERT( pts[0].firstSample == 0 && pts[0].numSamples == 1 );
+    TESTING_ASSERT( pts[1].firstSample == 10 && pts[1].numSamples == 1 );
+
+    TESTING_ASSERT( ids.size() == 2 );
+    TESTING_ASSERT( ids[0].firstSample == 3 && ids[0].numSamples == 2 );
+    TESTING_ASSERT( ids[1].firstSample == 8 && ids[1].numSamples == 1 );
+
+    return 0;
+}
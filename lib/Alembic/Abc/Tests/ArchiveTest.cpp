@@ -170,10 +170,81 @@ void scopingTest(bool useOgawa)
     }
 }
 
+void sampleIndexCacheTest()
+{
+    std::vector< chrono_t > times;
+    times.push_back( 0.0 );
+    times.push_back( 1.0 );
+    times.push_back( 3.0 );
+    times.push_back( 7.0 );
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+            "sampleIndexCacheTest.abc" );
+        AbcA::TimeSampling ts( AbcA::TimeSamplingType(
+            AbcA::TimeSamplingType::kAcyclic ), times );
+        uint32_t tsIndex = archive.addTimeSampling( ts );
+
+        OObject top = archive.getTop();
+        for ( int i = 0; i < 50; ++i )
+        {
+            std::ostringstream name;
+            name << "child" << i;
+            OObject child( top, name.str() );
+
+            // the last one is shorter
+            OInt32Property prop( child.getProperties(), "prop", tsIndex );
+            for ( int j = 0; j < ( i == 49 ? 3 : 4 ); ++j )
+            {
+                prop.set( j );
+            }
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+        "sampleIndexCacheTest.abc" );
+    SampleIndexCachePtr cache = archive.getSampleIndexCache();
+    TESTING_ASSERT( cache );
+    TESTING_ASSERT( cache->size() == 0 );
+
+    IObject top = archive.getTop();
+    TESTING_ASSERT( top.getArchive().getSampleIndexCache() == cache );
+
+    for ( int i = 0; i < 49; ++i )
+    {
+        IInt32Property prop( top.getChild( i ).getProperties(), "prop" );
+        TESTING_ASSERT( prop.getValue(
+            ISampleSelector( 3.5, ISampleSelector::kFloorIndex ) ) == 2 );
+        TESTING_ASSERT( prop.getValue(
+            ISampleSelector( 3.5, ISampleSelector::kCeilIndex ) ) == 3 );
+
+        // by index doesn't need the cache
+        TESTING_ASSERT( prop.getValue( ISampleSelector( index_t( 1 ) ) ) == 1 );
+    }
+
+    // each distinct lookup was only solved once
+    TESTING_ASSERT( cache->size() == 2 );
+
+    IInt32Property shortProp( top.getChild( 49 ).getProperties(), "prop" );
+    TESTING_ASSERT( shortProp.getValue(
+        ISampleSelector( 3.5, ISampleSelector::kCeilIndex ) ) == 2 );
+    TESTING_ASSERT( cache->size() == 3 );
+
+    cache->clear();
+    TESTING_ASSERT( cache->size() == 0 );
+
+    // still the same answers
+    IInt32Property prop( top.getChild( 0 ).getProperties(), "prop" );
+    TESTING_ASSERT( prop.getValue(
+        ISampleSelector( 3.5, ISampleSelector::kFloorIndex ) ) == 2 );
+    TESTING_ASSERT( cache->size() == 1 );
+}
+
 int main( int argc, char *argv[] )
 {
     archiveInfoTest(true);
     scopingTest(true);
+    sampleIndexCacheTest();
 
 #ifdef ALEMBIC_WITH_HDF5
     archiveInfoTest(false);
@@ -614,6 +614,279 @@ void emptyAndValueTest(const std::string &archiveName, bool useOgawa)
     }
 }
 
+//-*****************************************************************************
+void rangeReadTest(const std::string &archiveName, bool useOgawa)
+{
+    std::vector<V3f> vecs;
+    for ( size_t i = 0; i < 100; ++i )
+    {
+        vecs.push_back( V3f( i, 2.0 * i, 3.0 * i ) );
+    }
+
+    std::vector<std::string> strs;
+    strs.push_back( "a" );
+    strs.push_back( "bb" );
+    strs.push_back( "" );
+    strs.push_back( "dddd" );
+
+    {
+        OArchive archive;
+        if (useOgawa)
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                archiveName );
+        }
+#ifdef ALEMBIC_WITH_HDF5
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+                archiveName );
+        }
+#endif
+
+        OCompoundProperty root = archive.getTop().getProperties();
+        OV3fArrayProperty vecProp( root, "vecs" );
+        OStringArrayProperty strProp( root, "strings" );
+
+        vecProp.set( V3fArraySample( vecs ) );
+        for ( size_t i = 0; i < vecs.size(); ++i )
+        {
+            vecs[i] = -vecs[i];
+        }
+        vecProp.set( V3fArraySample( vecs ) );
+
+        strProp.set( StringArraySample( strs ) );
+    }
+
+    {
+        AbcF::IFactory factory;
+        factory.setPolicy(  ErrorHandler::kThrowPolicy );
+        AbcF::IFactory::CoreType coreType;
+        IArchive archive = factory.getArchive(archiveName, coreType);
+        TESTING_ASSERT( (useOgawa && coreType == AbcF::IFactory::kOgawa) ||
+                        (!useOgawa && coreType == AbcF::IFactory::kHDF5) );
+
+        ICompoundProperty root = archive.getTop().getProperties();
+        IV3fArrayProperty vecProp( root, "vecs" );
+        IStringArrayProperty strProp( root, "strings" );
+
+        V3fArraySamplePtr vecSamp;
+        vecProp.getRange( vecSamp, 10, 5, 0 );
+        TESTING_ASSERT( vecSamp->size() == 5 );
+        for ( size_t i = 0; i < 5; ++i )
+        {
+            TESTING_ASSERT( ( *vecSamp )[i] == V3f( 10 + i, 2.0 * ( 10 + i ),
+                3.0 * ( 10 + i ) ) );
+        }
+
+        vecProp.getRange( vecSamp, 95, 5, 1 );
+        TESTING_ASSERT( vecSamp->size() == 5 );
+        for ( size_t i = 0; i < 5; ++i )
+        {
+            TESTING_ASSERT( ( *vecSamp )[i] == vecs[95 + i] );
+        }
+
+        vecProp.getRange( vecSamp, 100, 0, 1 );
+        TESTING_ASSERT( vecSamp->size() == 0 );
+
+        bool threw = false;
+        try
+        {
+            vecProp.getRange( vecSamp, 98, 3, 1 );
+        }
+        catch ( std::exception & )
+        {
+            threw = true;
+        }
+        TESTING_ASSERT( threw );
+
+        StringArraySamplePtr strSamp;
+        strProp.getRange( strSamp, 1, 3 );
+        TESTING_ASSERT( strSamp->size() == 3 );
+        TESTING_ASSERT( ( *strSamp )[0] == "bb" );
+        TESTING_ASSERT( ( *strSamp )[1] == "" );
+        TESTING_ASSERT( ( *strSamp )[2] == "dddd" );
+    }
+}
+
+//-*****************************************************************************
+void allocatorTest(const std::string &archiveName, bool useOgawa)
+{
+    std::vector<V3f> vecs;
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        vecs.push_back( V3f( i, i, i ) );
+    }
+
+    {
+        OArchive archive;
+        if (useOgawa)
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                archiveName );
+        }
+#ifdef ALEMBIC_WITH_HDF5
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+                archiveName );
+        }
+#endif
+
+        OCompoundProperty root = archive.getTop().getProperties();
+        OV3fArrayProperty vecProp( root, "vecs" );
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            vecs[0].x = i;
+            vecProp.set( V3fArraySample( vecs ) );
+        }
+    }
+
+    AbcA::ArraySampleAllocatorPtr pool(
+        new AbcA::PooledArraySampleAllocator() );
+    AbcA::PooledArraySampleAllocator &pooled =
+        static_cast<AbcA::PooledArraySampleAllocator &>( *pool );
+
+    AbcF::IFactory factory;
+    factory.setPolicy(  ErrorHandler::kThrowPolicy );
+    factory.setArraySampleAllocator( pool );
+    IArchive archive = factory.getArchive( archiveName );
+    TESTING_ASSERT( archive.getArraySampleAllocator() == pool );
+
+    ICompoundProperty root = archive.getTop().getProperties();
+    IV3fArrayProperty vecProp( root, "vecs" );
+
+    // 10 V3fs land in the 128 byte size class
+    V3fArraySamplePtr samp;
+    vecProp.get( samp, 0 );
+    TESTING_ASSERT( samp->size() == 10 && ( *samp )[0].x == 0.0f &&
+                    ( *samp )[9] == V3f( 9, 9, 9 ) );
+    const void * firstBuffer = samp->getData();
+    TESTING_ASSERT( pooled.getNumRetainedBytes() == 0 );
+
+    samp.reset();
+    TESTING_ASSERT( pooled.getNumRetainedBytes() == 128 );
+
+    // the next frame reuses the buffer
+    vecProp.get( samp, 1 );
+    TESTING_ASSERT( samp->getData() == firstBuffer );
+    TESTING_ASSERT( pooled.getNumRetainedBytes() == 0 );
+    TESTING_ASSERT( ( *samp )[0].x == 1.0f && ( *samp )[9] == V3f( 9, 9, 9 ) );
+
+    vecProp.getRange( samp, 5, 5, 2 );
+    TESTING_ASSERT( samp->size() == 5 && ( *samp )[4] == V3f( 9, 9, 9 ) );
+
+    // samples keep the allocator alive
+    archive.setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr() );
+    pool.reset();
+    vecProp.get( samp, 2 );
+    TESTING_ASSERT( ( *samp )[0].x == 2.0f );
+    samp.reset();
+}
+
+//-*****************************************************************************
+// Reads the archive written by rangeReadTest straight into our own buffers
+void getIntoTest(const std::string &archiveName)
+{
+    AbcF::IFactory factory;
+    factory.setPolicy(  ErrorHandler::kThrowPolicy );
+    IArchive archive = factory.getArchive( archiveName );
+
+    ICompoundProperty root = archive.getTop().getProperties();
+    IV3fArrayProperty vecProp( root, "vecs" );
+    IStringArrayProperty strProp( root, "strings" );
+
+    std::vector<V3f> buffer( 128, V3f( 7, 7, 7 ) );
+    TESTING_ASSERT( vecProp.getInto( &buffer.front(), buffer.size(), 1 ) ==
+                    100 );
+    for ( size_t i = 0; i < 100; ++i )
+    {
+        TESTING_ASSERT( buffer[i] == -V3f( i, 2.0 * i, 3.0 * i ) );
+    }
+
+    // the rest of the buffer is left alone
+    TESTING_ASSERT( buffer[100] == V3f( 7, 7, 7 ) );
+
+    bool threw = false;
+    try
+    {
+        vecProp.getInto( &buffer.front(), 99, 0 );
+    }
+    catch ( std::exception & )
+    {
+        threw = true;
+    }
+    TESTING_ASSERT( threw );
+
+    std::vector<V3f> vecs;
+    vecProp.getInto( vecs, 0 );
+    TESTING_ASSERT( vecs.size() == 100 && vecs[99] == V3f( 99, 198, 297 ) );
+
+    std::vector<std::string> strs;
+    strProp.getInto( strs );
+    TESTING_ASSERT( strs.size() == 4 && strs[1] == "bb" && strs[3] == "dddd" );
+}
+
+void setFromTest(const std::string &srcName, const std::string &archiveName,
+                 bool useOgawa)
+{
+    AbcF::IFactory factory;
+    factory.setPolicy(  ErrorHandler::kThrowPolicy );
+    IArchive src = factory.getArchive( srcName );
+
+    ICompoundProperty srcRoot = src.getTop().getProperties();
+    IV3fArrayProperty srcVecs( srcRoot, "vecs" );
+    IStringArrayProperty srcStrs( srcRoot, "strings" );
+
+    {
+        OArchive archive;
+        if (useOgawa)
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                archiveName );
+        }
+#ifdef ALEMBIC_WITH_HDF5
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+                archiveName );
+        }
+#endif
+
+        OCompoundProperty root = archive.getTop().getProperties();
+        OV3fArrayProperty vecProp( root, "vecs" );
+        OStringArrayProperty strProp( root, "strings" );
+
+        // the last one is data which has already been written
+        vecProp.setFrom( srcVecs, 1 );
+        vecProp.setFrom( srcVecs, 0 );
+        vecProp.setFrom( srcVecs, 1 );
+        strProp.setFrom( srcStrs );
+    }
+
+    IArchive archive = factory.getArchive( archiveName );
+    ICompoundProperty root = archive.getTop().getProperties();
+    IV3fArrayProperty vecProp( root, "vecs" );
+    IStringArrayProperty strProp( root, "strings" );
+
+    TESTING_ASSERT( vecProp.getNumSamples() == 3 );
+    for ( index_t i = 0; i < 3; ++i )
+    {
+        V3fArraySamplePtr samp = vecProp.getValue( i );
+        TESTING_ASSERT( samp->size() == 100 );
+        float sign = ( i == 1 ) ? 1.0f : -1.0f;
+        TESTING_ASSERT( (*samp)[99] == sign * V3f( 99, 198, 297 ) );
+
+        AbcA::ArraySampleKey key, srcKey;
+        TESTING_ASSERT( vecProp.getKey( key, i ) );
+        TESTING_ASSERT( srcVecs.getKey( srcKey, ( i == 1 ) ? 0 : 1 ) );
+        TESTING_ASSERT( key.digest == srcKey.digest );
+    }
+
+    StringArraySamplePtr strs = strProp.getValue();
+    TESTING_ASSERT( strs->size() == 4 && (*strs)[3] == "dddd" );
+}
+
 int main( int argc, char *argv[] )
 {
     // Write and read a simple archive: one child, with one array
@@ -651,10 +924,19 @@ int main( int argc, char *argv[] )
 
     readWriteColorArrayProperty( "c3_2_array_test.abc", true );
     emptyAndValueTest( "empty_and_value_prop_test.abc", true );
+    rangeReadTest( "range_read_test.abc", true );
+    getIntoTest( "range_read_test.abc" );
+    setFromTest( "range_read_test.abc", "set_from_test.abc", true );
+    allocatorTest( "allocator_test.abc", true );
 
 #ifdef ALEMBIC_WITH_HDF5
     readWriteColorArrayProperty( "c3_2_array_test.abc", false );
     emptyAndValueTest( "empty_and_value_prop_test.abc", false );
+    rangeReadTest( "range_read_test.abc", false );
+    getIntoTest( "range_read_test.abc" );
+    setFromTest( "range_read_test.abc", "set_from_test.abc", true );
+    setFromTest( "range_read_test.abc", "set_from_test.abc", false );
+    allocatorTest( "allocator_test.abc", false );
 #endif
 
     try
@@ -411,6 +411,99 @@ void diabolicalInstance( const std::string& iArchiveName, bool useOgawa )
 
 }
 
+//-*****************************************************************************
+void sharedSampleTest( const std::string& iArchiveName, bool useOgawa )
+{
+    /*
+         src    (has the array property "P")
+          |
+         geo
+         p0  p1 (each has an instance targeting src)
+    */
+    {
+        OArchive archive;
+        if (useOgawa)
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                iArchiveName, ErrorHandler::kThrowPolicy );
+        }
+#ifdef ALEMBIC_WITH_HDF5
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+                iArchiveName, ErrorHandler::kThrowPolicy );
+        }
+#endif
+
+        OObject src( archive.getTop(), "src" );
+        OObject geo( src, "geo" );
+        OFloatArrayProperty prop( geo.getProperties(), "P" );
+        std::vector< float32_t > vals( 100, 3.0f );
+        prop.set( FloatArraySample( vals ) );
+
+        OObject p0( archive.getTop(), "p0" );
+        OObject p1( archive.getTop(), "p1" );
+        TESTING_ASSERT( p0.addChildInstance( src, "inst" ) );
+        TESTING_ASSERT( p1.addChildInstance( src, "inst" ) );
+    }
+
+    AbcF::IFactory factory;
+    factory.setSampleCache(
+        Alembic::AbcCoreAbstract::CreateSharedReadArraySampleCache() );
+    IArchive archive = factory.getArchive( iArchiveName );
+
+    IObject geo( IObject( archive.getTop(), "src" ), "geo" );
+    IObject geo0 = archive.getTop().getChild( "p0" ).getChild( "inst" ).
+        getChild( "geo" );
+    IObject geo1 = archive.getTop().getChild( "p1" ).getChild( "inst" ).
+        getChild( "geo" );
+
+    TESTING_ASSERT( geo0.getFullName() == "/p0/inst/geo" );
+    TESTING_ASSERT( geo1.getFullName() == "/p1/inst/geo" );
+    TESTING_ASSERT( geo.getInstanceGroup() == "/src/geo" );
+    TESTING_ASSERT( geo0.getInstanceGroup() == geo.getInstanceGroup() );
+    TESTING_ASSERT( geo1.getInstanceGroup() == geo.getInstanceGroup() );
+    TESTING_ASSERT( IObject( archive.getTop(), "p0" ).getInstanceGroup() ==
+                    "/p0" );
+
+    IFloatArrayProperty prop0( geo0.getProperties(), "P" );
+    IFloatArrayProperty prop1( geo1.getProperties(), "P" );
+
+    FloatArraySamplePtr samp0 = prop0.getValue();
+    FloatArraySamplePtr samp1 = prop1.getValue();
+    TESTING_ASSERT( samp0->size() == 100 );
+    TESTING_ASSERT( (*samp0)[99] == 3.0f );
+
+    // both instances got the very same decoded data
+    TESTING_ASSERT( samp0->getData() == samp1->getData() );
+
+#ifdef ALEMBIC_WITH_HDF5
+    // Ogawa ignores caches which aren't thread safe, like the HDF5 one
+    if ( useOgawa )
+    {
+        factory.setSampleCache( Alembic::AbcCoreHDF5::CreateCache() );
+        IArchive hcArchive = factory.getArchive( iArchiveName );
+        TESTING_ASSERT( !hcArchive.getReadArraySampleCachePtr() );
+
+        IObject hcGeo0 = hcArchive.getTop().getChild( "p0" ).
+            getChild( "inst" ).getChild( "geo" );
+        IObject hcGeo1 = hcArchive.getTop().getChild( "p1" ).
+            getChild( "inst" ).getChild( "geo" );
+        FloatArraySamplePtr hcSamp0 =
+            IFloatArrayProperty( hcGeo0.getProperties(), "P" ).getValue();
+        FloatArraySamplePtr hcSamp1 =
+            IFloatArrayProperty( hcGeo1.getProperties(), "P" ).getValue();
+        TESTING_ASSERT( (*hcSamp0)[99] == 3.0f );
+        TESTING_ASSERT( hcSamp0->getData() != hcSamp1->getData() );
+
+        IArchive ctorArchive( Alembic::AbcCoreOgawa::ReadArchive(),
+            iArchiveName, ErrorHandler::kThrowPolicy,
+            Alembic::AbcCoreHDF5::CreateCache() );
+        TESTING_ASSERT( !ctorArchive.getReadArraySampleCachePtr() );
+    }
+#endif
+}
+
 //-*****************************************************************************
 int main( int argc, char* argv[] )
 {
@@ -424,12 +517,14 @@ int main( int argc, char* argv[] )
     simpleTestOut( oarkhive, useOgawa );
     simpleTestIn( oarkhive );
     diabolicalInstance( oarkhive2, useOgawa );
+    sharedSampleTest( "sharedsample_ogawa.abc", useOgawa );
 
 #ifdef ALEMBIC_WITH_HDF5
     useOgawa = false;
     simpleTestOut( harkhive, useOgawa );
     simpleTestIn( harkhive );
     diabolicalInstance( harkhive2, useOgawa );
+    sharedSampleTest( "sharedsample_hdf5.abc", useOgawa );
 #endif
 
     return 0;
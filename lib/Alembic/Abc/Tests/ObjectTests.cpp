@@ -262,6 +262,98 @@ void readDeepHierarchy(const std::string &archiveName)
     // Done - the archive closes itself
 }
 
+void findObjectsInDeepHierarchy(const std::string &archiveName)
+{
+    AbcF::IFactory factory;
+    factory.setPolicy(  ErrorHandler::kThrowPolicy );
+    AbcF::IFactory::CoreType coreType;
+    IArchive archive = factory.getArchive(archiveName, coreType);
+
+    IObject top = archive.findObject( "/" );
+    ABCA_ASSERT( top && top.getFullName() == "/", "Expected the top object" );
+
+    // look everything up three times, the first two passes drop what they
+    // found and the last keeps it, while the previous object is still held
+    // onto a lookup of the same name has to hand back the same reader
+    std::vector< IObject > held;
+    for ( int pass = 0; pass < 3; ++pass )
+    {
+        for ( unsigned int ii = 0; ii < 2; ++ii )
+        {
+            for ( unsigned int jj = 0; jj < 2; ++jj )
+            {
+                for ( unsigned int kk = 0; kk < 2; ++kk )
+                {
+                    std::ostringstream strm;
+                    strm << "/child_0_" << ii << "/child_1_" << jj
+                         << "/child_2_" << kk;
+                    std::string name = strm.str();
+
+                    IObject obj = archive.findObject( name );
+                    ABCA_ASSERT( obj && obj.getFullName() == name,
+                                 "Could not find " << name );
+
+                    IObject parent = archive.findObject(
+                        name.substr( 0, name.rfind( '/' ) ) );
+                    ABCA_ASSERT( parent && parent.getFullName() ==
+                                 obj.getParent().getFullName(),
+                                 "Could not find the parent of " << name );
+
+                    ABCA_ASSERT( archive.findObject( name ).getPtr() ==
+                                 obj.getPtr(),
+                                 "Did not reuse the reader of " << name );
+
+                    if ( pass == 2 )
+                    {
+                        held.push_back( obj );
+                    }
+                }
+            }
+        }
+    }
+
+    for ( std::size_t i = 0; i < held.size(); ++i )
+    {
+        ABCA_ASSERT( archive.findObject( held[i].getFullName() ).getPtr() ==
+                     held[i].getPtr(),
+                     "Did not reuse the reader of " << held[i].getFullName() );
+    }
+
+    // names that differ only by redundant slashes resolve the same way
+    IObject obj = archive.findObject( "child_0_1//child_1_0/" );
+    ABCA_ASSERT( obj && obj.getFullName() == "/child_0_1/child_1_0",
+                 "Could not find /child_0_1/child_1_0" );
+
+    // missing objects, including below an existing object, are invalid
+    ABCA_ASSERT( !archive.findObject( "/child_0_2" ),
+                 "Found an object that does not exist" );
+    ABCA_ASSERT( !archive.findObject( "/child_0_0/child_1_0/nope" ),
+                 "Found an object that does not exist" );
+    ABCA_ASSERT( !archive.findObject( "/nope/child_1_0" ),
+                 "Found an object that does not exist" );
+
+    // only the objects on the path that was looked up get indexed
+    ObjectPathIndexPtr index = archive.getObjectPathIndex();
+    index->clear();
+    ABCA_ASSERT( archive.findObject( "/child_0_1/child_1_1/child_2_0" ),
+                 "Could not find /child_0_1/child_1_1/child_2_0" );
+    ABCA_ASSERT( index->size() == 3, "Indexed more than the path" );
+
+    // copies share the index
+    IArchive copied = archive;
+    ABCA_ASSERT( copied.getObjectPathIndex() == index,
+                 "Copies of the archive should share the index" );
+
+    // and it doesn't grow past its bound
+    ObjectPathIndex small( 2 );
+    AbcA::ObjectReaderPtr found =
+        small.find( archive.getPtr(), "/child_0_0/child_1_0/child_2_1" );
+    ABCA_ASSERT( found && found->getFullName() ==
+                 "/child_0_0/child_1_0/child_2_1",
+                 "Could not find /child_0_0/child_1_0/child_2_1" );
+    ABCA_ASSERT( small.size() <= 2, "The index grew past its bound" );
+}
+
 void readHierarchyMulti(const std::string &archiveName)
 {
 #ifdef ALEMBIC_WITH_HDF5
@@ -381,11 +473,13 @@ int main( int argc, char *argv[] )
         useOgawa = true;
         writeThreeDeepHierarchy ( archiveName, useOgawa );
         readDeepHierarchy  ( archiveName );
+        findObjectsInDeepHierarchy ( archiveName );
 
 #ifdef ALEMBIC_WITH_HDF5
         useOgawa = false;
         writeThreeDeepHierarchy ( archiveName, useOgawa );
         readDeepHierarchy  ( archiveName );
+        findObjectsInDeepHierarchy ( archiveName );
 #endif
     }
     catch (char * str )
@@ -0,0 +1,171 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <set>
+#include <stdexcept>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    OObject top = archive.getTop();
+
+    // one wide level followed by a few narrow ones, each object gets a
+    // scalar property, and a compound with a property in it
+    for ( int i = 0; i < 200; ++i )
+    {
+        std::ostringstream strm;
+        strm << "wide" << i;
+        OObject wide( top, strm.str() );
+
+        OObject parent = wide;
+        for ( int j = 0; j < 5; ++j )
+        {
+            std::ostringstream name;
+            name << "deep" << j;
+            OObject child( parent, name.str() );
+
+            OInt32Property prop( child.getProperties(), "value" );
+            prop.set( i * 10 + j );
+
+            OCompoundProperty comp( child.getProperties(), "comp" );
+            OStringProperty str( comp, "str" );
+            str.set( name.str() );
+
+            parent = child;
+        }
+    }
+}
+
+//-*****************************************************************************
+class NameCollector : public ParallelVisitor
+{
+public:
+    NameCollector( std::size_t iNumThreads )
+      : objects( iNumThreads )
+      , numProperties( iNumThreads, 0 )
+    {}
+
+    virtual bool visitObject( IObject & iObject, std::size_t iWorker )
+    {
+        TESTING_ASSERT( iWorker < objects.size() );
+        objects[iWorker].push_back( iObject.getFullName() );
+
+        // prune everything below the third wide object
+        return iObject.getFullName() != "/wide3";
+    }
+
+    virtual void visitProperty( ICompoundProperty & iParent,
+                                const AbcA::PropertyHeader & iHeader,
+                                std::size_t iWorker )
+    {
+        TESTING_ASSERT( iParent.getPropertyHeader( iHeader.getName() ) );
+        numProperties[iWorker]++;
+    }
+
+    std::vector< std::vector< std::string > > objects;
+    std::vector< std::size_t > numProperties;
+};
+
+//-*****************************************************************************
+class Thrower : public ParallelVisitor
+{
+public:
+    virtual bool visitObject( IObject & iObject, std::size_t iWorker )
+    {
+        if ( iObject.getName() == "deep3" )
+        {
+            throw std::runtime_error( "deep3 reached" );
+        }
+        return true;
+    }
+};
+
+//-*****************************************************************************
+void visitArchive( const std::string & iArchiveName, std::size_t iNumThreads )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive( iNumThreads ),
+                      iArchiveName );
+
+    ParallelVisitOptions options;
+    options.numThreads = iNumThreads;
+    options.visitProperties = true;
+    TESTING_ASSERT( GetParallelVisitNumThreads( options ) == iNumThreads );
+
+    NameCollector collector( iNumThreads );
+    ParallelVisit( archive.getTop(), collector, options );
+
+    std::set< std::string > names;
+    std::size_t numProperties = 0;
+    for ( std::size_t i = 0; i < iNumThreads; ++i )
+    {
+        names.insert( collector.objects[i].begin(),
+                      collector.objects[i].end() );
+        numProperties += collector.numProperties[i];
+    }
+
+    // the top, 200 wide objects, and 5 deep below all but one of them
+    TESTING_ASSERT( names.size() == 1 + 200 + 199 * 5 );
+    TESTING_ASSERT( names.count( "/" ) == 1 );
+    TESTING_ASSERT( names.count( "/wide3" ) == 1 );
+    TESTING_ASSERT( names.count( "/wide3/deep0" ) == 0 );
+    TESTING_ASSERT( names.count( "/wide199/deep0/deep1/deep2/deep3/deep4" )
+                    == 1 );
+
+    // value, comp, and comp/str on each deep object
+    TESTING_ASSERT( numProperties == 199 * 5 * 3 );
+
+    Thrower thrower;
+    TESTING_ASSERT_THROW( ParallelVisit( archive.getTop(), thrower, options ),
+                          Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string archiveName = "parallelVisit.abc";
+    writeArchive( archiveName );
+    visitArchive( archiveName, 1 );
+    visitArchive( archiveName, 4 );
+    return 0;
+}
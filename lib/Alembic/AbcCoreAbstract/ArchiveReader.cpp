@@ -46,6 +46,18 @@ ArchiveReader::~ArchiveReader()
     // Nothing
 }
 
+//-*****************************************************************************
+ArraySampleAllocatorPtr ArchiveReader::getArraySampleAllocator()
+{
+    return ArraySampleAllocatorPtr();
+}
+
+//-*****************************************************************************
+void ArchiveReader::setArraySampleAllocator( ArraySampleAllocatorPtr iPtr )
+{
+    // Nothing
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -41,6 +41,7 @@
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
 #include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleAllocator.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -106,6 +107,18 @@ public:
     //! will be disabled if a NULL cache is passed here.
     virtual void setReadArraySampleCachePtr( ReadArraySampleCachePtr iPtr ) = 0;
 
+    //! Get the allocator the buffers of the array samples read from this
+    //! archive come from. A NULL pointer means they are allocated with new[].
+    //! The default implementation always returns a NULL pointer.
+    virtual ArraySampleAllocatorPtr getArraySampleAllocator();
+
+    //! Set the allocator for the buffers of the array samples read from this
+    //! archive from now on. It may be a NULL pointer, in which case new[]
+    //! is used.  Allocators can be shared amongst separate archives.
+    //! The default implementation ignores it, for implementations which
+    //! don't support allocators.
+    virtual void setArraySampleAllocator( ArraySampleAllocatorPtr iPtr );
+
     //! Returns the TimeSampling at a given index.
     virtual TimeSamplingPtr getTimeSampling( uint32_t iIndex ) = 0;
 
@@ -35,6 +35,10 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ArrayPropertyReader.h>
+#include <Alembic/AbcCoreAbstract/ArchiveReader.h>
+#include <Alembic/AbcCoreAbstract/ObjectReader.h>
+
+#include <algorithm>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +50,55 @@ ArrayPropertyReader::~ArrayPropertyReader()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyReader::getSampleRange( index_t iSampleIndex,
+                                          size_t iElementOffset,
+                                          size_t iNumElements,
+                                          ArraySamplePtr &oSample )
+{
+    ArraySamplePtr whole;
+    getSample( iSampleIndex, whole );
+
+    ABCA_ASSERT( iElementOffset + iNumElements <= whole->size(),
+                 "Invalid range: " << iElementOffset << ", " << iNumElements
+                 << " for a sample of " << whole->size() << " elements." );
+
+    const DataType &dataType = whole->getDataType();
+    oSample = AllocateArraySample( dataType, Dimensions( iNumElements ),
+        getObject()->getArchive()->getArraySampleAllocator() );
+
+    if ( iNumElements == 0 )
+    {
+        return;
+    }
+
+    size_t extent = dataType.getExtent();
+    size_t first = iElementOffset * extent;
+    size_t last = first + iNumElements * extent;
+
+    if ( dataType.getPod() == kStringPOD )
+    {
+        const std::string *src =
+            static_cast< const std::string * >( whole->getData() );
+        std::copy( src + first, src + last, static_cast< std::string * >(
+            const_cast< void * >( oSample->getData() ) ) );
+    }
+    else if ( dataType.getPod() == kWstringPOD )
+    {
+        const std::wstring *src =
+            static_cast< const std::wstring * >( whole->getData() );
+        std::copy( src + first, src + last, static_cast< std::wstring * >(
+            const_cast< void * >( oSample->getData() ) ) );
+    }
+    else
+    {
+        size_t numBytes = dataType.getNumBytes();
+        memcpy( const_cast< void * >( oSample->getData() ),
+                static_cast< const char * >( whole->getData() ) +
+                iElementOffset * numBytes, iNumElements * numBytes );
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
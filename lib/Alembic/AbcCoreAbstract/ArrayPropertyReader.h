@@ -93,6 +93,21 @@ public:
     virtual void getSample( index_t iSampleIndex,
                             ArraySamplePtr &oSample ) = 0;
 
+    //! Read only iNumElements elements of the sample, starting at element
+    //! iElementOffset.  Elements are counted the way the sample's
+    //! Dimensions::numPoints counts them, so a V3f array has one element
+    //! per vector.  The returned sample is rank 1 with iNumElements points.
+    //! The range must lie within the sample, otherwise this throws.
+    //! Culling and LOD code can use this to read small slices of very large
+    //! arrays.
+    //! The default implementation reads the whole sample and copies out
+    //! the range, implementations should override it with a real
+    //! partial read where the storage allows it.
+    virtual void getSampleRange( index_t iSampleIndex,
+                                 size_t iElementOffset,
+                                 size_t iNumElements,
+                                 ArraySamplePtr &oSample );
+
     //! Find the largest valid index that has a time less than or equal
     //! to the given time. Invalid to call this with zero samples.
     //! If the minimum sample time is greater than iTime, index
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ArrayPropertyWriter.h>
+#include <Alembic/AbcCoreAbstract/ArrayPropertyReader.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +47,17 @@ ArrayPropertyWriter::~ArrayPropertyWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyWriter::setSampleFrom( ArrayPropertyReaderPtr iReader,
+                                         index_t iSampleIndex )
+{
+    ABCA_ASSERT( iReader, "Invalid ArrayPropertyReader" );
+
+    ArraySamplePtr samp;
+    iReader->getSample( iSampleIndex, samp );
+    setSample( *samp );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
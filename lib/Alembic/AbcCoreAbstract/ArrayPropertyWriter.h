@@ -79,6 +79,13 @@ public:
     //! An important feature!
     virtual void setFromPreviousSample() = 0;
 
+    //! Sets the next sample to the sample at iSampleIndex of iReader, which
+    //! must have the same DataType.  Implementations may transfer the stored
+    //! data and its key directly when the reader comes from the same kind of
+    //! archive, by default the sample is read and then set.
+    virtual void setSampleFrom( ArrayPropertyReaderPtr iReader,
+                                index_t iSampleIndex );
+
     //! Return the number of samples that have been written so far.
     //! This changes as samples are written.
     virtual size_t getNumSamples() = 0;
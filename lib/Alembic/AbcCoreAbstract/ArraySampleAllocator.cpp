@@ -0,0 +1,196 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/ArraySampleAllocator.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ArraySampleAllocator::~ArraySampleAllocator()
+{
+    // Nothing!
+}
+
+//-*****************************************************************************
+namespace {
+
+// Hands the buffer back to the allocator it came from, the pointer to the
+// allocator keeps it alive for as long as the sample is.
+class AllocatorDeleter
+{
+public:
+    AllocatorDeleter( ArraySampleAllocatorPtr iAllocator, size_t iNumBytes )
+      : m_allocator( iAllocator ), m_numBytes( iNumBytes ) {}
+
+    void operator()( ArraySample *iSample ) const
+    {
+        if ( iSample )
+        {
+            m_allocator->deallocate(
+                const_cast<void*>( iSample->getData() ), m_numBytes );
+        }
+        delete iSample;
+    }
+
+private:
+    ArraySampleAllocatorPtr m_allocator;
+    size_t m_numBytes;
+};
+
+}
+
+//-*****************************************************************************
+ArraySamplePtr AllocateArraySample( const DataType &iDtype,
+                                    const Dimensions &iDims,
+                                    ArraySampleAllocatorPtr iAllocator )
+{
+    size_t numBytes = iDtype.getNumBytes() * iDims.numPoints();
+
+    if ( !iAllocator || numBytes == 0 || iDtype.getPod() == kStringPOD ||
+         iDtype.getPod() == kWstringPOD )
+    {
+        return AllocateArraySample( iDtype, iDims );
+    }
+
+    void * data = iAllocator->allocate( numBytes );
+    if ( !data )
+    {
+        return AllocateArraySample( iDtype, iDims );
+    }
+
+    return ArraySamplePtr( new ArraySample( data, iDtype, iDims ),
+                           AllocatorDeleter( iAllocator, numBytes ) );
+}
+
+//-*****************************************************************************
+PooledArraySampleAllocator::PooledArraySampleAllocator(
+    size_t iMaxRetainedBytes )
+  : m_maxRetainedBytes( iMaxRetainedBytes )
+  , m_retainedBytes( 0 )
+  , m_freeBuffers( sizeof( size_t ) * 8 )
+{
+}
+
+//-*****************************************************************************
+PooledArraySampleAllocator::~PooledArraySampleAllocator()
+{
+    clear();
+}
+
+//-*****************************************************************************
+size_t PooledArraySampleAllocator::sizeClass( size_t iNumBytes )
+{
+    size_t c = 0;
+    while ( ( size_t( 1 ) << c ) < iNumBytes )
+    {
+        ++c;
+    }
+    return c;
+}
+
+//-*****************************************************************************
+void * PooledArraySampleAllocator::allocate( size_t iNumBytes )
+{
+    size_t c = sizeClass( iNumBytes );
+
+    {
+        Alembic::Util::scoped_lock l( m_mutex );
+        std::vector< void * > &buffers = m_freeBuffers[c];
+        if ( !buffers.empty() )
+        {
+            void * ret = buffers.back();
+            buffers.pop_back();
+            m_retainedBytes -= size_t( 1 ) << c;
+            return ret;
+        }
+    }
+
+    // malloc is aligned for any of the PODs
+    return malloc( size_t( 1 ) << c );
+}
+
+//-*****************************************************************************
+void PooledArraySampleAllocator::deallocate( void * iMemory,
+                                             size_t iNumBytes )
+{
+    if ( !iMemory )
+    {
+        return;
+    }
+
+    size_t c = sizeClass( iNumBytes );
+    size_t classBytes = size_t( 1 ) << c;
+
+    {
+        Alembic::Util::scoped_lock l( m_mutex );
+        if ( m_retainedBytes + classBytes <= m_maxRetainedBytes )
+        {
+            m_freeBuffers[c].push_back( iMemory );
+            m_retainedBytes += classBytes;
+            return;
+        }
+    }
+
+    free( iMemory );
+}
+
+//-*****************************************************************************
+void PooledArraySampleAllocator::clear()
+{
+    Alembic::Util::scoped_lock l( m_mutex );
+    for ( size_t c = 0; c < m_freeBuffers.size(); ++c )
+    {
+        for ( size_t i = 0; i < m_freeBuffers[c].size(); ++i )
+        {
+            free( m_freeBuffers[c][i] );
+        }
+        m_freeBuffers[c].clear();
+    }
+    m_retainedBytes = 0;
+}
+
+//-*****************************************************************************
+size_t PooledArraySampleAllocator::getNumRetainedBytes() const
+{
+    Alembic::Util::scoped_lock l( m_mutex );
+    return m_retainedBytes;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -0,0 +1,129 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreAbstract_ArraySampleAllocator_h_
+#define _Alembic_AbcCoreAbstract_ArraySampleAllocator_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/ArraySample.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! By default the buffers of the array samples handed out by the readers
+//! come from new[], one allocation per sample read.  An ArraySampleAllocator
+//! can be installed on an ArchiveReader to provide that memory instead,
+//! from an arena, a pool of recycled buffers, huge pages or whatever suits
+//! the application.
+//! Samples keep a pointer to the allocator which provided their buffer, so
+//! it will outlive every sample allocated from it.
+//! Allocators may be called from many threads at once.
+class ALEMBIC_EXPORT ArraySampleAllocator
+    : private Alembic::Util::noncopyable
+{
+public:
+    //! Virtual destructor
+    //! ...
+    virtual ~ArraySampleAllocator();
+
+    //! Return a buffer of at least iNumBytes bytes, suitably aligned for
+    //! any of the POD types.  Returning NULL makes the sample fall back to
+    //! new[].
+    virtual void * allocate( size_t iNumBytes ) = 0;
+
+    //! Give back a buffer previously returned by allocate for the same
+    //! iNumBytes.
+    virtual void deallocate( void * iMemory, size_t iNumBytes ) = 0;
+};
+
+typedef Alembic::Util::shared_ptr<ArraySampleAllocator> ArraySampleAllocatorPtr;
+
+//-*****************************************************************************
+//! Same as AllocateArraySample, but the buffer comes from iAllocator when it
+//! is not NULL.  String and wstring samples need their elements constructed
+//! and so are always allocated with new[].
+ALEMBIC_EXPORT ArraySamplePtr
+AllocateArraySample( const DataType &iDtype,
+                     const Dimensions &iDims,
+                     ArraySampleAllocatorPtr iAllocator );
+
+//-*****************************************************************************
+//! An ArraySampleAllocator which keeps the buffers given back to it and hands
+//! them out again.  Buffers are grouped in power of two size classes, so a
+//! buffer can be reused for any sample of the same class, which is what
+//! happens when the same objects are read frame after frame.
+//! At most iMaxRetainedBytes bytes are kept around, anything given back
+//! past that is freed straight away.
+class ALEMBIC_EXPORT PooledArraySampleAllocator : public ArraySampleAllocator
+{
+public:
+    PooledArraySampleAllocator( size_t iMaxRetainedBytes = 1024 * 1024 * 1024 );
+
+    virtual ~PooledArraySampleAllocator();
+
+    virtual void * allocate( size_t iNumBytes );
+
+    virtual void deallocate( void * iMemory, size_t iNumBytes );
+
+    //! Frees all of the retained buffers, buffers still in use by samples
+    //! are unaffected.
+    void clear();
+
+    //! Number of bytes held by the pool, waiting to be reused.
+    size_t getNumRetainedBytes() const;
+
+private:
+    static size_t sizeClass( size_t iNumBytes );
+
+    mutable Alembic::Util::mutex m_mutex;
+    size_t m_maxRetainedBytes;
+    size_t m_retainedBytes;
+
+    // one free list per power of two size class
+    std::vector< std::vector< void * > > m_freeBuffers;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
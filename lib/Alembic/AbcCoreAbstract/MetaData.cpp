@@ -0,0 +1,146 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2015,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/MetaData.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Deferred MetaData is parsed under a lock, but giving every MetaData its own
+// mutex would make them expensive to copy, so instead they share a small
+// pool of locks picked by address.  Everything that looks at m_isDeferred,
+// m_deferred or the parsed m_tokenMap of a MetaData takes its lock first.
+static const std::size_t kNUM_DEFERRED_LOCKS = 64;
+static Alembic::Util::mutex g_deferredLocks[kNUM_DEFERRED_LOCKS];
+
+static Alembic::Util::mutex & GetDeferredLock( const void * iAddress )
+{
+    std::size_t addr = reinterpret_cast< std::size_t >( iAddress );
+    return g_deferredLocks[ ( addr >> 4 ) % kNUM_DEFERRED_LOCKS ];
+}
+
+//-*****************************************************************************
+// Finds the value of iKey in a serialized MetaData string, walking the pairs
+// the same way TokenMap::setUnique does so the first one wins.
+static std::string FindSerializedValue( const std::string &iSerialized,
+                                        const std::string &iKey )
+{
+    std::size_t lastPair = 0;
+    while ( true )
+    {
+        std::size_t curPair = iSerialized.find( ';', lastPair );
+        std::size_t curAssign = iSerialized.find( '=', lastPair );
+
+        if ( curAssign != std::string::npos &&
+             iSerialized.compare( lastPair, curAssign - lastPair, iKey ) == 0 )
+        {
+            std::size_t length = std::string::npos;
+            if ( curPair != std::string::npos )
+            {
+                length = curPair - curAssign - 1;
+            }
+            return iSerialized.substr( curAssign + 1, length );
+        }
+
+        if ( curPair == std::string::npos )
+        {
+            return std::string();
+        }
+
+        lastPair = curPair + 1;
+    }
+}
+
+//-*****************************************************************************
+std::string MetaData::serialize() const
+{
+    Alembic::Util::scoped_lock l( GetDeferredLock( this ) );
+    if ( m_isDeferred )
+    {
+        return m_deferred;
+    }
+
+    return m_tokenMap.get( ';', '=', true );
+}
+
+//-*****************************************************************************
+const Alembic::Util::TokenMap & MetaData::tokenMap() const
+{
+    Alembic::Util::scoped_lock l( GetDeferredLock( this ) );
+    if ( m_isDeferred )
+    {
+        m_tokenMap.clear();
+        m_tokenMap.setUnique( m_deferred, ';', '=', true );
+        m_deferred.clear();
+        m_isDeferred = false;
+    }
+    return m_tokenMap;
+}
+
+//-*****************************************************************************
+Alembic::Util::TokenMap & MetaData::tokenMap()
+{
+    const MetaData * self = this;
+    self->tokenMap();
+    return m_tokenMap;
+}
+
+//-*****************************************************************************
+std::string MetaData::value( const std::string &iKey ) const
+{
+    Alembic::Util::scoped_lock l( GetDeferredLock( this ) );
+    if ( m_isDeferred )
+    {
+        return FindSerializedValue( m_deferred, iKey );
+    }
+
+    return m_tokenMap.value( iKey );
+}
+
+//-*****************************************************************************
+void MetaData::copyFrom( const MetaData &iCopy )
+{
+    Alembic::Util::scoped_lock l( GetDeferredLock( &iCopy ) );
+    m_tokenMap = iCopy.m_tokenMap;
+    m_deferred = iCopy.m_deferred;
+    m_isDeferred = iCopy.m_isDeferred;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -37,6 +37,7 @@
 #ifndef _Alembic_AbcCoreAbstract_MetaData_h_
 #define _Alembic_AbcCoreAbstract_MetaData_h_
 
+#include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 
 namespace Alembic {
@@ -56,7 +57,9 @@ namespace ALEMBIC_VERSION_NS {
 //! In order to not have duplicated (and possibly conflicting) policy
 //! implementation, we present this class here as a MOSTLY-WRITE-ONCE interface,
 //! with selective exception throwing behavior for failed writes.
-class MetaData
+//! A MetaData may also hold on to its serialized string and only parse it
+//! the first time its contents are needed, see \ref deserializeDeferred.
+class ALEMBIC_EXPORT MetaData
 {   
 public:
     //-*************************************************************************
@@ -98,17 +101,23 @@ public:
 
     //! Default constructor creates an empty dictionary.
     //! ...
-    MetaData() {}
+    MetaData() : m_isDeferred( false ) {}
 
     //! Copy constructor copies another MetaData.
-    //! ...
-    MetaData( const MetaData &iCopy ) : m_tokenMap( iCopy.m_tokenMap ) {}
+    //! If the other MetaData hasn't been parsed yet, neither is the copy.
+    MetaData( const MetaData &iCopy ) : m_isDeferred( false )
+    {
+        copyFrom( iCopy );
+    }
 
     //! Assignment operator copies the contents of another
     //! MetaData instance.
     MetaData& operator=( const MetaData &iCopy )
     {
-        m_tokenMap = iCopy.m_tokenMap;
+        if ( this != &iCopy )
+        {
+            copyFrom( iCopy );
+        }
         return *this;
     }
 
@@ -122,22 +131,36 @@ public:
     //! \internal For library implementation internal use.
     void deserialize( const std::string &iFrom )
     {
+        m_deferred.clear();
+        m_isDeferred = false;
         m_tokenMap.clear();
         m_tokenMap.setUnique( iFrom, ';', '=', true );
     }
 
-    //! Serialization will convert the contents of this MetaData into a
-    //! single string.
+    //! Like deserialize, except that the string is only kept around until
+    //! the contents are first accessed, which is when it is parsed. Readers
+    //! use this so that walking a hierarchy for names doesn't pay for
+    //! parsing every header's MetaData.  A mal-formed string will throw
+    //! when it is parsed instead of here.
     //! \internal For library implementation internal use.
-    std::string serialize() const
+    void deserializeDeferred( const std::string &iFrom )
     {
-        return m_tokenMap.get( ';', '=', true );
+        m_tokenMap.clear();
+        m_deferred = iFrom;
+        m_isDeferred = true;
     }
 
+    //! Serialization will convert the contents of this MetaData into a
+    //! single string.
+    //! A MetaData that hasn't been parsed yet returns the string it was
+    //! given without parsing it.
+    //! \internal For library implementation internal use.
+    std::string serialize() const;
+
     //-*************************************************************************
     // SIZE
     //-*************************************************************************
-    size_t size() const { return m_tokenMap.size(); }
+    size_t size() const { return tokenMap().size(); }
     
     //-*************************************************************************
     // ITERATION
@@ -145,19 +168,19 @@ public:
 
     //! Returns a \ref const_iterator corresponding to the beginning of the
     //! MetaData or the end of the MetaData if empty.
-    const_iterator begin() const { return m_tokenMap.begin(); }
+    const_iterator begin() const { return tokenMap().begin(); }
 
     //! Returns a \ref const_iterator corresponding to the end of the
     //! MetaData.
-    const_iterator end() const { return m_tokenMap.end(); }
+    const_iterator end() const { return tokenMap().end(); }
 
     //! Returns a \ref const_reverse_iterator corresponding to the beginning
     //! of the MetaData or the end of the MetaData if empty.
-    const_reverse_iterator rbegin() const { return m_tokenMap.rbegin(); }
+    const_reverse_iterator rbegin() const { return tokenMap().rbegin(); }
 
     //! Returns an \ref const_reverse_iterator corresponding to the end
     //! of the MetaData.
-    const_reverse_iterator rend() const { return m_tokenMap.rend(); }
+    const_reverse_iterator rend() const { return tokenMap().rend(); }
 
     //-*************************************************************************
     // ACCESS/ASSIGNMENT
@@ -167,7 +190,7 @@ public:
     //! This will silently overwrite an existing value.
     void set( const std::string &iKey, const std::string &iData )
     {
-        m_tokenMap.setValue( iKey, iData );
+        tokenMap().setValue( iKey, iData );
     }
 
     //! setUnique lets you set a key/data pair,
@@ -176,10 +199,10 @@ public:
     //! \remarks Not the most efficient implementation at the moment.
     void setUnique( const std::string &iKey, const std::string &iData )
     {
-        std::string found = m_tokenMap.value( iKey );
+        std::string found = tokenMap().value( iKey );
         if ( found == "" )
         {
-            m_tokenMap.setValue( iKey, iData );
+            tokenMap().setValue( iKey, iData );
         }
         else if ( found != iData )
         {
@@ -189,16 +212,18 @@ public:
 
     //! get returns the value, or an empty string if it is not set.
     //! ...
+    //! A MetaData that hasn't been parsed yet is searched without parsing
+    //! it.
     std::string get( const std::string &iKey ) const
     {
-        return m_tokenMap.value( iKey );
+        return value( iKey );
     }
 
     //! getRequired returns the value, and throws an exception if it is
     //! not found.
     std::string getRequired( const std::string &iKey ) const
     {
-        std::string ret = m_tokenMap.value( iKey );
+        std::string ret = value( iKey );
         if ( ret == "" )
         {
             ABCA_THROW( "Key: " << iKey << " did not exist in MetaData" );
@@ -273,11 +298,25 @@ public:
     //! It is for this reason that we explicitly do not overload the == operator.
     bool matchesExactly( const MetaData &iMetaData ) const
     {
-        return m_tokenMap.exactMatch( iMetaData.m_tokenMap );
+        return tokenMap().exactMatch( iMetaData.tokenMap() );
     }
     
 private:
-    Alembic::Util::TokenMap m_tokenMap;
+    //! Returns the parsed contents, parsing the deferred string first if
+    //! there is one.  Readers share headers (and their MetaData) between
+    //! threads, so the parse is done under a lock.
+    const Alembic::Util::TokenMap &tokenMap() const;
+    Alembic::Util::TokenMap &tokenMap();
+
+    void copyFrom( const MetaData &iCopy );
+
+    std::string value( const std::string &iKey ) const;
+
+    mutable Alembic::Util::TokenMap m_tokenMap;
+
+    // the serialized string handed to deserializeDeferred, until parsed
+    mutable std::string m_deferred;
+    mutable bool m_isDeferred;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+#include <algorithm>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +47,113 @@ ReadArraySampleCache::~ReadArraySampleCache()
     // Nothing!
 }
 
+//-*****************************************************************************
+SharedReadArraySampleCache::SharedReadArraySampleCache()
+    : m_purgeSize( 64 )
+{
+}
+
+//-*****************************************************************************
+SharedReadArraySampleCache::~SharedReadArraySampleCache()
+{
+}
+
+//-*****************************************************************************
+ReadArraySampleID
+SharedReadArraySampleCache::find( const ArraySample::Key &iKey )
+{
+    Alembic::Util::scoped_lock l( m_mutex );
+
+    Map::iterator foundIter = m_map.find( iKey );
+    if ( foundIter == m_map.end() )
+    {
+        return ReadArraySampleID();
+    }
+
+    ArraySamplePtr samp = foundIter->second.lock();
+    if ( !samp )
+    {
+        m_map.erase( foundIter );
+        return ReadArraySampleID();
+    }
+
+    return ReadArraySampleID( iKey, samp );
+}
+
+//-*****************************************************************************
+ReadArraySampleID
+SharedReadArraySampleCache::store( const ArraySample::Key &iKey,
+                                   ArraySamplePtr iSamp )
+{
+    ABCA_ASSERT( iSamp, "Cannot store a null sample" );
+
+    Alembic::Util::scoped_lock l( m_mutex );
+
+    // someone else may have stored it while we were decoding ours
+    Map::iterator foundIter = m_map.find( iKey );
+    if ( foundIter != m_map.end() )
+    {
+        ArraySamplePtr samp = foundIter->second.lock();
+        if ( samp )
+        {
+            return ReadArraySampleID( iKey, samp );
+        }
+        foundIter->second = iSamp;
+        return ReadArraySampleID( iKey, iSamp );
+    }
+
+    if ( m_map.size() >= m_purgeSize )
+    {
+        purgeExpired();
+    }
+
+    m_map[iKey] = iSamp;
+    return ReadArraySampleID( iKey, iSamp );
+}
+
+//-*****************************************************************************
+std::size_t SharedReadArraySampleCache::getNumLiveEntries() const
+{
+    Alembic::Util::scoped_lock l( m_mutex );
+
+    std::size_t numLive = 0;
+    for ( Map::const_iterator it = m_map.begin(); it != m_map.end(); ++it )
+    {
+        if ( !it->second.expired() )
+        {
+            ++numLive;
+        }
+    }
+    return numLive;
+}
+
+//-*****************************************************************************
+// m_mutex is expected to be held.  Dropping the expired entries only once
+// the map has doubled since the last purge keeps store amortized constant.
+void SharedReadArraySampleCache::purgeExpired()
+{
+    Map::iterator it = m_map.begin();
+    while ( it != m_map.end() )
+    {
+        if ( it->second.expired() )
+        {
+            m_map.erase( it++ );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    m_purgeSize = std::max( std::size_t( 64 ), m_map.size() * 2 );
+}
+
+//-*****************************************************************************
+ReadArraySampleCachePtr CreateSharedReadArraySampleCache()
+{
+    return ReadArraySampleCachePtr( new SharedReadArraySampleCache() );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
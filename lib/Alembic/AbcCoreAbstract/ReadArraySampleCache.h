@@ -40,6 +40,7 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -137,6 +138,43 @@ public:
 //-*****************************************************************************
 typedef Alembic::Util::shared_ptr<ReadArraySampleCache> ReadArraySampleCachePtr;
 
+//-*****************************************************************************
+//! A thread safe cache which shares decoded samples by key without owning
+//! them.  As long as any client still holds a sample, reading data with the
+//! same key (for example the same property reached through several
+//! instances of an object) returns that very sample instead of decoding it
+//! again.  Once the last client lets go, the memory is released, so the
+//! cache never grows the memory footprint beyond what is in use.
+class ALEMBIC_EXPORT SharedReadArraySampleCache : public ReadArraySampleCache
+{
+public:
+    SharedReadArraySampleCache();
+
+    virtual ~SharedReadArraySampleCache();
+
+    virtual ReadArraySampleID find( const ArraySample::Key &iKey );
+
+    virtual ReadArraySampleID store( const ArraySample::Key &iKey,
+                                     ArraySamplePtr iSamp );
+
+    //! Returns the number of entries whose sample is still alive.
+    std::size_t getNumLiveEntries() const;
+
+private:
+    void purgeExpired();
+
+    typedef UnorderedMapUtil< Alembic::Util::weak_ptr<ArraySample> >::umap_type
+        Map;
+
+    mutable Alembic::Util::mutex m_mutex;
+    Map m_map;
+    std::size_t m_purgeSize;
+};
+
+//-*****************************************************************************
+//! Creates a SharedReadArraySampleCache
+ALEMBIC_EXPORT ReadArraySampleCachePtr CreateSharedReadArraySampleCache();
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -557,6 +557,59 @@ void testAcyclicTime3()
     testTimeSampling<TIME>( tSamp, tSampTyp, numSamps );
 }
 
+//-*****************************************************************************
+void testAcyclicLookups()
+{
+    TimeVector tvec;
+    const size_t numSamps = 5000;
+
+    for ( size_t i = 0 ; i < numSamps ; ++i )
+    {
+        tvec.push_back( (chrono_t)i * ( 1.0 / 24.0 ) );
+    }
+
+    const AbcA::TimeSamplingType tSampTyp( AbcA::TimeSamplingType::kAcyclic );
+    AbcA::TimeSampling tSamp( tSampTyp, tvec );
+
+    std::cout << "Testing repeated acyclic lookups" << std::endl;
+
+    // asking for the same times over and over should keep giving the same
+    // answers
+    for ( size_t pass = 0; pass < 3; ++pass )
+    {
+        for ( size_t i = 1 ; i < numSamps - 1 ; ++i )
+        {
+            chrono_t t = tvec[i] + 0.01;
+            TESTING_ASSERT( tSamp.getFloorIndex( t, numSamps ).first ==
+                            ( index_t ) i );
+            TESTING_ASSERT( tSamp.getCeilIndex( t, numSamps ).first ==
+                            ( index_t ) i + 1 );
+            TESTING_ASSERT( tSamp.getNearIndex( t, numSamps ).first ==
+                            ( index_t ) i );
+        }
+    }
+
+    // a smaller sample count only changes where we clamp
+    TESTING_ASSERT( tSamp.getFloorIndex( tvec[100] + 0.01, 50 ).first == 49 );
+    TESTING_ASSERT( tSamp.getFloorIndex( tvec[10] + 0.01, 50 ).first == 10 );
+
+    // assigning a new sampling gives the answers for the new times
+    TimeVector halfVec;
+    for ( size_t i = 0 ; i < numSamps ; ++i )
+    {
+        halfVec.push_back( (chrono_t)i * ( 1.0 / 48.0 ) );
+    }
+
+    tSamp = AbcA::TimeSampling( tSampTyp, halfVec );
+    TESTING_ASSERT( tSamp.getFloorIndex( tvec[10] + 0.01, numSamps ).first ==
+                    20 );
+
+    // and copies agree with the original
+    AbcA::TimeSampling tSampCopy( tSamp );
+    TESTING_ASSERT( tSampCopy.getFloorIndex( tvec[10] + 0.01, numSamps ) ==
+                    tSamp.getFloorIndex( tvec[10] + 0.01, numSamps ) );
+}
+
 //-*****************************************************************************
 void testBadTypes()
 {
@@ -613,6 +666,9 @@ int main( int, char** )
     testAcyclicTime2<chrono_t>();
     testAcyclicTime3<chrono_t>();
 
+    // many acyclic lookups, repeated
+    testAcyclicLookups();
+
     // test with doubles
     testCyclicTime1<double>();
     testUniformTime1<double>();
@@ -36,6 +36,7 @@
 
 #include <fstream>
 #include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreLayer/Read.h>
 #include <Alembic/AbcCoreFactory/IFactory.h>
 
 #ifdef ALEMBIC_WITH_HDF5
@@ -70,6 +71,7 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
     {
         oType = kOgawa;
         archive.getErrorHandler().setPolicy( m_policy );
+        archive.setArraySampleAllocator( m_allocator );
         return archive;
     }
 
@@ -81,6 +83,7 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
     {
         oType = kHDF5;
         archive.getErrorHandler().setPolicy( m_policy );
+        archive.setArraySampleAllocator( m_allocator );
         return archive;
     }
 #else
@@ -114,6 +117,42 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName )
     return getArchive( iFileName, coreType );
 }
 
+Alembic::Abc::IArchive IFactory::getArchive(
+    const std::vector< std::string > & iFileNames, CoreType & oType )
+{
+    if ( iFileNames.size() == 1 )
+    {
+        return getArchive( iFileNames[0], oType );
+    }
+
+    Alembic::AbcCoreLayer::ArchiveReaderPtrs archives;
+    std::vector< std::string >::const_iterator it = iFileNames.begin();
+    for ( ; it != iFileNames.end(); ++it )
+    {
+        Alembic::Abc::IArchive archive = getArchive( *it, oType );
+        if ( !archive.valid() )
+        {
+            oType = kUnknown;
+            return Alembic::Abc::IArchive();
+        }
+
+        archives.push_back( archive.getPtr() );
+    }
+
+    if ( archives.empty() )
+    {
+        oType = kUnknown;
+        return Alembic::Abc::IArchive();
+    }
+
+    Alembic::AbcCoreLayer::ReadArchive layer;
+    oType = kLayer;
+    Alembic::Abc::IArchive archive( layer( archives ),
+        Alembic::Abc::kWrapExisting, m_policy );
+    archive.setArraySampleAllocator( m_allocator );
+    return archive;
+}
+
 Alembic::Abc::IArchive IFactory::getArchive(
     const std::vector< std::istream * > & iStreams, CoreType & oType)
 {
@@ -123,6 +162,7 @@ Alembic::Abc::IArchive IFactory::getArchive(
     if ( archive.valid() )
     {
         oType = kOgawa;
+        archive.setArraySampleAllocator( m_allocator );
         return archive;
     }
 
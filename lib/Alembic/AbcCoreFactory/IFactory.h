@@ -56,6 +56,7 @@ public:
     {
         kHDF5,
         kOgawa,
+        kLayer,
         kUnknown
     };
 
@@ -68,6 +69,14 @@ public:
     //! file or known type and invalid archive is returned.
     Alembic::Abc::IArchive getArchive( const std::string & iFileName );
 
+    //! Open all of the files and layer them on top of each other, in the
+    //! given order (see AbcCoreLayer::ReadArchive.)  If only one file is
+    //! given this is the same as opening it directly, otherwise oType is
+    //! set to kLayer.  If any of the files can not be opened, an invalid
+    //! IArchive is returned and oType is set to kUnknown.
+    Alembic::Abc::IArchive getArchive(
+        const std::vector< std::string > & iFileNames, CoreType & oType );
+
     //! Use the streams (Alembic does not take ownership) to read the data from
     //! This is currently only valid for Ogawa.  The streams must all reference
     //! the same data.
@@ -84,7 +93,10 @@ public:
     //! Gets whether an HDF5 file will use the cached hierarchy
     bool getHDF5CacheHierarchy() const { return m_cacheHierarchy; }
 
-    //! Set the array sample cache, the HDF5 implementation optionally uses this
+    //! Set the array sample cache which is used to share array samples which
+    //! have the same key, such as the data read through several instances of
+    //! the same object.  Ogawa reads from multiple threads so it only uses
+    //! an AbcCoreAbstract::SharedReadArraySampleCache and ignores any other.
     void setSampleCache(
         Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCachePtr )
     {
@@ -97,6 +109,21 @@ public:
         return m_cachePtr;
     }
 
+    //! Set the allocator used for the array samples read from the archives
+    //! opened from now on, NULL means new[] is used (the default.)
+    void setArraySampleAllocator(
+        Alembic::AbcCoreAbstract::ArraySampleAllocatorPtr iAllocator )
+    {
+        m_allocator = iAllocator;
+    }
+
+    //! Get the array sample allocator
+    Alembic::AbcCoreAbstract::ArraySampleAllocatorPtr
+    getArraySampleAllocator() const
+    {
+        return m_allocator;
+    }
+
     //! Gets the number of streams that will be opened when opening an Ogawa
     //! file
     size_t getOgawaNumStreams() const { return m_numStreams; }
@@ -121,6 +148,7 @@ private:
     bool m_cacheHierarchy;
     size_t m_numStreams;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
+    Alembic::AbcCoreAbstract::ArraySampleAllocatorPtr m_allocator;
     Alembic::Abc::ErrorHandler::Policy m_policy;
 
 };
@@ -103,6 +103,45 @@ void AprImpl::getDimensions( index_t iSampleIndex, Dimensions & oDim )
     }
 }
 
+//-*****************************************************************************
+void AprImpl::getSampleRange( index_t iSampleIndex,
+                              size_t iElementOffset,
+                              size_t iNumElements,
+                              AbcA::ArraySamplePtr &oSample )
+{
+    const AbcA::DataType &dataType = m_header->getDataType();
+
+    // strings are packed into one big buffer, let the base class copy
+    // them out of the full sample
+    if ( dataType.getPod() == kStringPOD || dataType.getPod() == kWstringPOD )
+    {
+        AbcA::ArrayPropertyReader::getSampleRange( iSampleIndex,
+            iElementOffset, iNumElements, oSample );
+        return;
+    }
+
+    iSampleIndex = verifySampleIndex( iSampleIndex );
+
+    std::string sampleName = getSampleName( m_header->getName(), iSampleIndex );
+    H5Node parent;
+
+    if ( iSampleIndex == 0 )
+    {
+        parent = m_parentGroup;
+    }
+    else
+    {
+        checkSamplesIGroup();
+        parent = m_samplesIGroup;
+    }
+
+    oSample = ReadArrayRange( parent.getObject(), sampleName, dataType,
+                              m_nativeDataType, iElementOffset,
+                              iNumElements,
+                              getObject()->getArchive()->
+                              getArraySampleAllocator() );
+}
+
 //-*****************************************************************************
 void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
                      PlainOldDataType iPod )
@@ -160,11 +199,13 @@ void AprImpl::readSample( hid_t iGroup,
 
     // Read the array sample, possibly from the cache.
     const AbcA::DataType &dataType = m_header->getDataType();
+    AbcA::ArchiveReaderPtr archive = this->getObject()->getArchive();
     AbcA::ReadArraySampleCachePtr cachePtr =
-        this->getObject()->getArchive()->getReadArraySampleCachePtr();
+        archive->getReadArraySampleCachePtr();
     oSamplePtr = ReadArray( cachePtr, iGroup, iSampleName, dataType,
                             m_fileDataType,
-                            m_nativeDataType );
+                            m_nativeDataType,
+                            archive->getArraySampleAllocator() );
 }
 
 //-*****************************************************************************
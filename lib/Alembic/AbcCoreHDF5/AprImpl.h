@@ -60,6 +60,10 @@ public:
     virtual AbcA::ArrayPropertyReaderPtr asArrayPtr();
     virtual bool isScalarLike();
     virtual void getDimensions( index_t iSampleIndex, Dimensions & oDim );
+    virtual void getSampleRange( index_t iSampleIndex,
+                                 size_t iElementOffset,
+                                 size_t iNumElements,
+                                 AbcA::ArraySamplePtr &oSample );
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod );
 protected:
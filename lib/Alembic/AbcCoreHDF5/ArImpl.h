@@ -87,6 +87,18 @@ public:
         m_readArraySampleCache = iPtr;
     }
 
+    virtual AbcA::ArraySampleAllocatorPtr getArraySampleAllocator()
+    {
+        return m_allocator;
+    }
+
+    //! THIS METHOD IS NOT MULTITHREAD SAFE
+    virtual void
+    setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iPtr )
+    {
+        m_allocator = iPtr;
+    }
+
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
         uint32_t iIndex );
 
@@ -116,6 +128,8 @@ private:
 
     AbcA::ReadArraySampleCachePtr m_readArraySampleCache;
 
+    AbcA::ArraySampleAllocatorPtr m_allocator;
+
     HDF5Hierarchy m_H5H;
 };
 
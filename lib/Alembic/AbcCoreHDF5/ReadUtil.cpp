@@ -551,7 +551,8 @@ ReadArray( AbcA::ReadArraySampleCachePtr iCache,
            const std::string &iName,
            const AbcA::DataType &iDataType,
            hid_t iFileType,
-           hid_t iNativeType )
+           hid_t iNativeType,
+           AbcA::ArraySampleAllocatorPtr iAllocator )
 {
     // Dispatch string stuff.
     if ( iDataType.getPod() == kStringPOD )
@@ -651,7 +652,7 @@ ReadArray( AbcA::ReadArraySampleCachePtr iCache,
                      "Degenerate dims in Dataset read" );
 
         // Create a buffer into which we shall read.
-        ret = AbcA::AllocateArraySample( iDataType, dims );
+        ret = AbcA::AllocateArraySample( iDataType, dims, iAllocator );
         assert( ret->getData() );
 
         // And... read into it.
@@ -768,6 +769,74 @@ ReadArray( void * iIntoLocation,
     }
 }
 
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+ReadArrayRange( hid_t iParent,
+                const std::string &iName,
+                const AbcA::DataType &iDataType,
+                hid_t iNativeType,
+                size_t iElementOffset,
+                size_t iNumElements,
+                AbcA::ArraySampleAllocatorPtr iAllocator )
+{
+    assert( iDataType.getPod() != kStringPOD &&
+            iDataType.getPod() != kWstringPOD );
+
+    // Open the data set.
+    hid_t dsetId = H5Dopen( iParent, iName.c_str(), H5P_DEFAULT );
+    ABCA_ASSERT( dsetId >= 0, "Cannot open dataset: " << iName );
+    DsetCloser dsetCloser( dsetId );
+
+    // Read the data space.
+    hid_t dspaceId = H5Dget_space( dsetId );
+    ABCA_ASSERT( dspaceId >= 0, "Could not get dataspace for dataSet: "
+                 << iName );
+    DspaceCloser dspaceCloser( dspaceId );
+
+    hsize_t extent = iDataType.getExtent();
+    hsize_t hdim = 0;
+
+    if ( H5Sget_simple_extent_type( dspaceId ) == H5S_SIMPLE )
+    {
+        int rank = H5Sget_simple_extent_ndims( dspaceId );
+        ABCA_ASSERT( rank == 1,
+                     "H5Sget_simple_extent_ndims() must be 1." );
+
+        H5Sget_simple_extent_dims( dspaceId, &hdim, NULL );
+    }
+
+    ABCA_ASSERT( iElementOffset + iNumElements <= hdim / extent,
+                 "Invalid range: " << iElementOffset << ", " << iNumElements
+                 << " for a sample of " << hdim / extent << " elements." );
+
+    AbcA::ArraySamplePtr ret = AbcA::AllocateArraySample( iDataType,
+        Dimensions( iNumElements ), iAllocator );
+
+    if ( iNumElements == 0 )
+    {
+        return ret;
+    }
+
+    // The dataset is flattened down to the pod, so select extent pods
+    // per element.
+    hsize_t start = iElementOffset * extent;
+    hsize_t count = iNumElements * extent;
+    herr_t status = H5Sselect_hyperslab( dspaceId, H5S_SELECT_SET, &start,
+                                         NULL, &count, NULL );
+    ABCA_ASSERT( status >= 0, "H5Sselect_hyperslab() failed." );
+
+    hid_t memSpaceId = H5Screate_simple( 1, &count, NULL );
+    ABCA_ASSERT( memSpaceId >= 0, "Could not create memory dataspace." );
+    DspaceCloser memSpaceCloser( memSpaceId );
+
+    status = H5Dread( dsetId, iNativeType, memSpaceId, dspaceId, H5P_DEFAULT,
+                      const_cast<void*>( ret->getData() ) );
+
+    ABCA_ASSERT( status >= 0, "H5Dread() failed." );
+
+    return ret;
+}
+
 //-*****************************************************************************
 void
 ReadTimeSamples( hid_t iParent,
@@ -117,7 +117,8 @@ ReadArray( AbcA::ReadArraySampleCachePtr iCache,
            const std::string &iArrayName,
            const AbcA::DataType &iDataType,
            hid_t iFileType,
-           hid_t iNativeType );
+           hid_t iNativeType,
+           AbcA::ArraySampleAllocatorPtr iAllocator );
 
 //-*****************************************************************************
 void
@@ -127,6 +128,18 @@ ReadArray( void * iIntoLocation,
            const AbcA::DataType &iDataType,
            hid_t iType );
 
+//-*****************************************************************************
+// Reads iNumElements elements starting at iElementOffset via a hyperslab
+// selection.  Not suitable for string and wstring.
+AbcA::ArraySamplePtr
+ReadArrayRange( hid_t iParent,
+                const std::string &iName,
+                const AbcA::DataType &iDataType,
+                hid_t iNativeType,
+                size_t iElementOffset,
+                size_t iNumElements,
+                AbcA::ArraySampleAllocatorPtr iAllocator );
+
 //-*****************************************************************************
 // Fills in oTimeSamples with the different TimeSampling that the archive uses
 // Intrinsically all archives have the first TimeSampling for uniform time 
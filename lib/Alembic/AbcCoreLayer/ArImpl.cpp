@@ -0,0 +1,177 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreLayer/ArImpl.h>
+#include <Alembic/AbcCoreLayer/OrImpl.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ArImpl::ArImpl( const ArchiveReaderPtrs & iArchives )
+  : m_archives( iArchives )
+{
+    ABCA_ASSERT( !m_archives.empty(), "No archives provided to layer." );
+
+    ArchiveReaderPtrs::iterator it = m_archives.begin();
+    for ( ; it != m_archives.end(); ++it )
+    {
+        ABCA_ASSERT( *it, "Invalid archive provided to layer." );
+
+        Util::uint32_t numSamplings = ( *it )->getNumTimeSamplings();
+        for ( Util::uint32_t i = 0; i < numSamplings; ++i )
+        {
+            AbcA::TimeSamplingPtr ts = ( *it )->getTimeSampling( i );
+            AbcA::index_t maxSamples =
+                ( *it )->getMaxNumSamplesForTimeSamplingIndex( i );
+
+            std::size_t j = 0;
+            for ( ; j < m_timeSamples.size(); ++j )
+            {
+                if ( *m_timeSamples[j] == *ts )
+                {
+                    break;
+                }
+            }
+
+            if ( j == m_timeSamples.size() )
+            {
+                m_timeSamples.push_back( ts );
+                m_maxSamples.push_back( maxSamples );
+            }
+            else if ( maxSamples == INDEX_UNKNOWN ||
+                      m_maxSamples[j] == INDEX_UNKNOWN )
+            {
+                m_maxSamples[j] = INDEX_UNKNOWN;
+            }
+            else
+            {
+                m_maxSamples[j] = std::max( m_maxSamples[j], maxSamples );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+ArImpl::~ArImpl()
+{
+}
+
+//-*****************************************************************************
+const std::string &ArImpl::getName() const
+{
+    return m_archives[0]->getName();
+}
+
+//-*****************************************************************************
+const AbcA::MetaData &ArImpl::getMetaData() const
+{
+    return m_archives[0]->getMetaData();
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr ArImpl::getTop()
+{
+    Alembic::Util::scoped_lock l( m_orlock );
+
+    AbcA::ObjectReaderPtr ret = m_top.lock();
+    if ( ! ret )
+    {
+        ObjectReaderPtrs tops;
+        ArchiveReaderPtrs::iterator it = m_archives.begin();
+        for ( ; it != m_archives.end(); ++it )
+        {
+            tops.push_back( ( *it )->getTop() );
+        }
+
+        // time to make a new one
+        ret = Alembic::Util::shared_ptr<OrImpl>(
+            new OrImpl( shared_from_this(), tops ) );
+        m_top = ret;
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+AbcA::TimeSamplingPtr ArImpl::getTimeSampling( Util::uint32_t iIndex )
+{
+    ABCA_ASSERT( iIndex < m_timeSamples.size(),
+        "Invalid index provided to getTimeSampling." );
+
+    return m_timeSamples[iIndex];
+}
+
+//-*****************************************************************************
+AbcA::ArchiveReaderPtr ArImpl::asArchivePtr()
+{
+    return shared_from_this();
+}
+
+//-*****************************************************************************
+AbcA::index_t
+ArImpl::getMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex )
+{
+    if ( iIndex < m_maxSamples.size() )
+    {
+        return m_maxSamples[iIndex];
+    }
+
+    return INDEX_UNKNOWN;
+}
+
+//-*****************************************************************************
+Util::int32_t ArImpl::getArchiveVersion()
+{
+    return m_archives[0]->getArchiveVersion();
+}
+
+//-*****************************************************************************
+void ArImpl::setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iPtr )
+{
+    m_allocator = iPtr;
+
+    ArchiveReaderPtrs::iterator it = m_archives.begin();
+    for ( ; it != m_archives.end(); ++it )
+    {
+        ( *it )->setArraySampleAllocator( iPtr );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
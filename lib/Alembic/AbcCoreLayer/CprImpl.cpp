@@ -0,0 +1,272 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreLayer/CprImpl.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+CprImpl::CprImpl( Alembic::Util::shared_ptr< OrImpl > iObject,
+                  const CompoundReaderPtrs & iLayers )
+    : m_object( iObject )
+    , m_layers( iLayers )
+{
+    ABCA_ASSERT( m_object, "Invalid object in CprImpl(Object)" );
+
+    init();
+}
+
+//-*****************************************************************************
+CprImpl::CprImpl( Alembic::Util::shared_ptr< CprImpl > iParent,
+                  const CompoundReaderPtrs & iLayers )
+    : m_parent( iParent )
+    , m_layers( iLayers )
+{
+    ABCA_ASSERT( m_parent, "Invalid parent in CprImpl(Compound)" );
+
+    m_object = m_parent->m_object;
+
+    init();
+}
+
+//-*****************************************************************************
+void CprImpl::init()
+{
+    ABCA_ASSERT( !m_layers.empty(), "No layers in CprImpl" );
+
+    // same rules as for objects, except that only compounds get merged,
+    // anything else simply hides what came before it
+    for ( std::size_t l = 0; l < m_layers.size(); ++l )
+    {
+        std::size_t numProps = m_layers[l]->getNumProperties();
+        for ( std::size_t i = 0; i < numProps; ++i )
+        {
+            const AbcA::PropertyHeader & header =
+                m_layers[l]->getPropertyHeader( i );
+
+            ChildNameMap::iterator fiter =
+                m_childNameMap.find( header.getName() );
+
+            if ( header.getMetaData().get( "prune" ) == "1" )
+            {
+                if ( fiter != m_childNameMap.end() )
+                {
+                    m_children[fiter->second].layers.clear();
+                    m_childNameMap.erase( fiter );
+                }
+                continue;
+            }
+
+            if ( fiter == m_childNameMap.end() )
+            {
+                m_childNameMap[header.getName()] = m_children.size();
+                m_children.push_back( Child() );
+                m_children.back().layers.push_back( LayerIndex( l, i ) );
+                continue;
+            }
+
+            Child & child = m_children[fiter->second];
+            const LayerIndex & last = child.layers.back();
+            if ( !header.isCompound() ||
+                 !m_layers[last.first]->getPropertyHeader(
+                    last.second ).isCompound() ||
+                 header.getMetaData().get( "replace" ) == "1" )
+            {
+                child.layers.clear();
+            }
+            child.layers.push_back( LayerIndex( l, i ) );
+        }
+    }
+
+    // squeeze out what was pruned
+    std::size_t numKept = 0;
+    for ( std::size_t i = 0; i < m_children.size(); ++i )
+    {
+        if ( m_children[i].layers.empty() )
+        {
+            continue;
+        }
+
+        if ( numKept != i )
+        {
+            m_children[numKept] = m_children[i];
+        }
+
+        LayerIndex & last = m_children[numKept].layers.back();
+        m_childNameMap[ m_layers[last.first]->getPropertyHeader(
+            last.second ).getName() ] = numKept;
+        ++numKept;
+    }
+    m_children.resize( numKept );
+}
+
+//-*****************************************************************************
+CprImpl::~CprImpl()
+{
+    // Nothing.
+}
+
+//-*****************************************************************************
+const AbcA::PropertyHeader & CprImpl::getHeader() const
+{
+    return m_layers.back()->getHeader();
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr CprImpl::getObject()
+{
+    return m_object;
+}
+
+//-*****************************************************************************
+AbcA::CompoundPropertyReaderPtr CprImpl::getParent()
+{
+    return m_parent;
+}
+
+//-*****************************************************************************
+AbcA::CompoundPropertyReaderPtr CprImpl::asCompoundPtr()
+{
+    return shared_from_this();
+}
+
+//-*****************************************************************************
+size_t CprImpl::getNumProperties()
+{
+    return m_children.size();
+}
+
+//-*****************************************************************************
+const AbcA::PropertyHeader & CprImpl::getPropertyHeader( size_t i )
+{
+    ABCA_ASSERT( i < m_children.size(),
+        "Out of range index in CprImpl::getPropertyHeader: " << i );
+
+    const LayerIndex & last = m_children[i].layers.back();
+    return m_layers[last.first]->getPropertyHeader( last.second );
+}
+
+//-*****************************************************************************
+const AbcA::PropertyHeader *
+CprImpl::getPropertyHeader( const std::string &iName )
+{
+    ChildNameMap::iterator fiter = m_childNameMap.find( iName );
+    if ( fiter == m_childNameMap.end() )
+    {
+        return NULL;
+    }
+
+    return & getPropertyHeader( fiter->second );
+}
+
+//-*****************************************************************************
+const LayerIndex * CprImpl::getLastLayer( const std::string &iName )
+{
+    ChildNameMap::iterator fiter = m_childNameMap.find( iName );
+    if ( fiter == m_childNameMap.end() )
+    {
+        return NULL;
+    }
+
+    return & m_children[fiter->second].layers.back();
+}
+
+//-*****************************************************************************
+// Scalar and array properties are handed out as is from the layer they
+// came from, so their parent is that layer's compound rather than this one.
+AbcA::ScalarPropertyReaderPtr
+CprImpl::getScalarProperty( const std::string &iName )
+{
+    const LayerIndex * last = getLastLayer( iName );
+    if ( !last )
+    {
+        return AbcA::ScalarPropertyReaderPtr();
+    }
+
+    return m_layers[last->first]->getScalarProperty( iName );
+}
+
+//-*****************************************************************************
+AbcA::ArrayPropertyReaderPtr
+CprImpl::getArrayProperty( const std::string &iName )
+{
+    const LayerIndex * last = getLastLayer( iName );
+    if ( !last )
+    {
+        return AbcA::ArrayPropertyReaderPtr();
+    }
+
+    return m_layers[last->first]->getArrayProperty( iName );
+}
+
+//-*****************************************************************************
+AbcA::CompoundPropertyReaderPtr
+CprImpl::getCompoundProperty( const std::string &iName )
+{
+    ChildNameMap::iterator fiter = m_childNameMap.find( iName );
+    if ( fiter == m_childNameMap.end() )
+    {
+        return AbcA::CompoundPropertyReaderPtr();
+    }
+
+    Child & child = m_children[fiter->second];
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    AbcA::CompoundPropertyReaderPtr cptr = child.made.lock();
+    if ( ! cptr )
+    {
+        CompoundReaderPtrs layers;
+        LayerIndices::iterator it = child.layers.begin();
+        for ( ; it != child.layers.end(); ++it )
+        {
+            layers.push_back(
+                m_layers[it->first]->getCompoundProperty( iName ) );
+        }
+
+        cptr = Alembic::Util::shared_ptr< CprImpl >(
+            new CprImpl( shared_from_this(), layers ) );
+        child.made = cptr;
+    }
+
+    return cptr;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
@@ -0,0 +1,81 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreLayer_Foundation_h_
+#define _Alembic_AbcCoreLayer_Foundation_h_
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreLayer/Read.h>
+
+#include <Alembic/Util/All.h>
+
+#include <vector>
+#include <string>
+#include <map>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+namespace AbcA = ::Alembic::AbcCoreAbstract;
+
+using AbcA::index_t;
+using AbcA::chrono_t;
+
+//-*****************************************************************************
+typedef Alembic::Util::weak_ptr< AbcA::ObjectReader > WeakOrPtr;
+typedef Alembic::Util::weak_ptr< AbcA::CompoundPropertyReader > WeakCprPtr;
+
+typedef std::vector< AbcA::ObjectReaderPtr > ObjectReaderPtrs;
+typedef std::vector< AbcA::CompoundPropertyReaderPtr > CompoundReaderPtrs;
+
+//-*****************************************************************************
+// Where a merged child comes from, the index of the layer, and the index of
+// the child within that layer.
+typedef std::pair< std::size_t, std::size_t > LayerIndex;
+typedef std::vector< LayerIndex > LayerIndices;
+
+typedef std::map< std::string, std::size_t > ChildNameMap;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
+
+#endif
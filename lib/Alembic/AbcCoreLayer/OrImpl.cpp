@@ -0,0 +1,258 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreLayer/OrImpl.h>
+#include <Alembic/AbcCoreLayer/CprImpl.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+OrImpl::OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
+                const ObjectReaderPtrs & iLayers )
+    : m_archive( iArchive )
+    , m_layers( iLayers )
+{
+    ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Archive)" );
+
+    init();
+}
+
+//-*****************************************************************************
+OrImpl::OrImpl( Alembic::Util::shared_ptr< OrImpl > iParent,
+                const ObjectReaderPtrs & iLayers )
+    : m_parent( iParent )
+    , m_layers( iLayers )
+{
+    ABCA_ASSERT( m_parent, "Invalid parent in OrImpl(Object)" );
+
+    m_archive = m_parent->m_archive;
+
+    init();
+}
+
+//-*****************************************************************************
+void OrImpl::init()
+{
+    ABCA_ASSERT( !m_layers.empty(), "No layers in OrImpl" );
+
+    // merge the children of each layer in order, a child keeps the position
+    // it was first seen at unless it gets pruned
+    for ( std::size_t l = 0; l < m_layers.size(); ++l )
+    {
+        std::size_t numChildren = m_layers[l]->getNumChildren();
+        for ( std::size_t i = 0; i < numChildren; ++i )
+        {
+            const AbcA::ObjectHeader & header =
+                m_layers[l]->getChildHeader( i );
+
+            ChildNameMap::iterator fiter =
+                m_childNameMap.find( header.getName() );
+
+            // get doesn't parse MetaData that the reader deferred, so this
+            // doesn't undo the deferred parsing of every child's header
+            if ( header.getMetaData().get( "prune" ) == "1" )
+            {
+                if ( fiter != m_childNameMap.end() )
+                {
+                    m_children[fiter->second].layers.clear();
+                    m_childNameMap.erase( fiter );
+                }
+                continue;
+            }
+
+            if ( fiter == m_childNameMap.end() )
+            {
+                m_childNameMap[header.getName()] = m_children.size();
+                m_children.push_back( Child() );
+                m_children.back().layers.push_back( LayerIndex( l, i ) );
+                continue;
+            }
+
+            Child & child = m_children[fiter->second];
+            if ( header.getMetaData().get( "replace" ) == "1" )
+            {
+                child.layers.clear();
+            }
+            child.layers.push_back( LayerIndex( l, i ) );
+        }
+    }
+
+    // squeeze out what was pruned
+    std::size_t numKept = 0;
+    for ( std::size_t i = 0; i < m_children.size(); ++i )
+    {
+        if ( m_children[i].layers.empty() )
+        {
+            continue;
+        }
+
+        if ( numKept != i )
+        {
+            m_children[numKept] = m_children[i];
+        }
+
+        LayerIndex & last = m_children[numKept].layers.back();
+        m_childNameMap[ m_layers[last.first]->getChildHeader(
+            last.second ).getName() ] = numKept;
+        ++numKept;
+    }
+    m_children.resize( numKept );
+}
+
+//-*****************************************************************************
+OrImpl::~OrImpl()
+{
+    // Nothing.
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader & OrImpl::getHeader() const
+{
+    return m_layers.back()->getHeader();
+}
+
+//-*****************************************************************************
+AbcA::ArchiveReaderPtr OrImpl::getArchive()
+{
+    return m_archive;
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr OrImpl::getParent()
+{
+    return m_parent;
+}
+
+//-*****************************************************************************
+AbcA::CompoundPropertyReaderPtr OrImpl::getProperties()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+
+    AbcA::CompoundPropertyReaderPtr ret = m_properties.lock();
+    if ( ! ret )
+    {
+        CompoundReaderPtrs props;
+        ObjectReaderPtrs::iterator it = m_layers.begin();
+        for ( ; it != m_layers.end(); ++it )
+        {
+            props.push_back( ( *it )->getProperties() );
+        }
+
+        ret = Alembic::Util::shared_ptr< CprImpl >(
+            new CprImpl( shared_from_this(), props ) );
+        m_properties = ret;
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+size_t OrImpl::getNumChildren()
+{
+    return m_children.size();
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader & OrImpl::getChildHeader( size_t i )
+{
+    ABCA_ASSERT( i < m_children.size(),
+        "Out of range index in OrImpl::getChildHeader: " << i );
+
+    const LayerIndex & last = m_children[i].layers.back();
+    return m_layers[last.first]->getChildHeader( last.second );
+}
+
+//-*****************************************************************************
+const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
+{
+    ChildNameMap::iterator fiter = m_childNameMap.find( iName );
+    if ( fiter == m_childNameMap.end() )
+    {
+        return NULL;
+    }
+
+    return & getChildHeader( fiter->second );
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr OrImpl::getChild( const std::string &iName )
+{
+    ChildNameMap::iterator fiter = m_childNameMap.find( iName );
+    if ( fiter == m_childNameMap.end() )
+    {
+        return AbcA::ObjectReaderPtr();
+    }
+
+    return getChild( fiter->second );
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr OrImpl::getChild( size_t i )
+{
+    ABCA_ASSERT( i < m_children.size(),
+        "Out of range index in OrImpl::getChild: " << i );
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    AbcA::ObjectReaderPtr optr = m_children[i].made.lock();
+    if ( ! optr )
+    {
+        ObjectReaderPtrs layers;
+        LayerIndices::iterator it = m_children[i].layers.begin();
+        for ( ; it != m_children[i].layers.end(); ++it )
+        {
+            layers.push_back( m_layers[it->first]->getChild( it->second ) );
+        }
+
+        optr = Alembic::Util::shared_ptr< OrImpl >(
+            new OrImpl( shared_from_this(), layers ) );
+        m_children[i].made = optr;
+    }
+
+    return optr;
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr OrImpl::asObjectPtr()
+{
+    return shared_from_this();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
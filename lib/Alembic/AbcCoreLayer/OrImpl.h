@@ -0,0 +1,121 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreLayer_OrImpl_h_
+#define _Alembic_AbcCoreLayer_OrImpl_h_
+
+#include <Alembic/AbcCoreLayer/Foundation.h>
+#include <Alembic/AbcCoreLayer/ArImpl.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+class OrImpl
+    : public AbcA::ObjectReader
+    , public Alembic::Util::enable_shared_from_this<OrImpl>
+{
+
+public:
+
+    OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
+            const ObjectReaderPtrs & iLayers );
+
+    OrImpl( Alembic::Util::shared_ptr< OrImpl > iParent,
+            const ObjectReaderPtrs & iLayers );
+
+    virtual ~OrImpl();
+
+    //-*************************************************************************
+    // ABSTRACT
+    //-*************************************************************************
+    virtual const AbcA::ObjectHeader & getHeader() const;
+
+    virtual AbcA::ArchiveReaderPtr getArchive();
+
+    virtual AbcA::ObjectReaderPtr getParent();
+
+    virtual AbcA::CompoundPropertyReaderPtr getProperties();
+
+    virtual size_t getNumChildren();
+
+    virtual const AbcA::ObjectHeader & getChildHeader( size_t i );
+
+    virtual const AbcA::ObjectHeader * getChildHeader
+    ( const std::string &iName );
+
+    virtual AbcA::ObjectReaderPtr getChild( const std::string &iName );
+
+    virtual AbcA::ObjectReaderPtr getChild( size_t i );
+
+    virtual AbcA::ObjectReaderPtr asObjectPtr();
+
+private:
+
+    void init();
+
+    // The parent object
+    Alembic::Util::shared_ptr< OrImpl > m_parent;
+
+    Alembic::Util::shared_ptr< ArImpl > m_archive;
+
+    // this object in each of the layers it is found in, the last one
+    // provides the header
+    ObjectReaderPtrs m_layers;
+
+    struct Child
+    {
+        LayerIndices layers;
+        WeakOrPtr made;
+    };
+
+    std::vector< Child > m_children;
+    ChildNameMap m_childNameMap;
+
+    WeakCprPtr m_properties;
+
+    Alembic::Util::mutex m_lock;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,80 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreLayer_Read_h_
+#define _Alembic_AbcCoreLayer_Read_h_
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Util/Export.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+typedef std::vector< ::Alembic::AbcCoreAbstract::ArchiveReaderPtr >
+    ArchiveReaderPtrs;
+
+//-*****************************************************************************
+//! Will return a shared pointer to an archive reader which presents the given
+//! archives as a single merged one.  Nothing is copied, objects and
+//! properties are read from the archive they came from.
+//!
+//! Archives later in the list are layered on top of the earlier ones.
+//! Objects and compound properties which exist in several layers have their
+//! children merged, the header (and so the MetaData) comes from the last
+//! layer.  Scalar and array properties come entirely from the last layer
+//! they are found in.
+//!
+//! Objects and properties written with SetPrune remove what the earlier
+//! layers had by that name, and those written with SetReplace hide what the
+//! earlier layers had instead of being merged with it.
+class ALEMBIC_EXPORT ReadArchive
+{
+public:
+    ReadArchive();
+
+    ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
+    operator()( const ArchiveReaderPtrs & iArchives ) const;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
+
+#endif
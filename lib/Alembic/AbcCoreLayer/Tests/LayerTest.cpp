@@ -0,0 +1,178 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+#include <Alembic/AbcCoreLayer/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+namespace Abc = Alembic::Abc;
+namespace AbcF = Alembic::AbcCoreFactory;
+namespace AbcL = Alembic::AbcCoreLayer;
+using namespace Abc;
+
+//-*****************************************************************************
+void writeBase( const std::string & iArchiveName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    OObject top = archive.getTop();
+
+    OObject a( top, "a" );
+    OInt32Property( a.getProperties(), "x" ).set( 1 );
+    OCompoundProperty c( a.getProperties(), "c" );
+    OInt32Property( c, "p" ).set( 1 );
+    OInt32Property( c, "shared" ).set( 1 );
+
+    OObject b( a, "b" );
+    OObject d( top, "d" );
+    OObject g( top, "g" );
+    OObject h( g, "h" );
+}
+
+//-*****************************************************************************
+void writeOver( const std::string & iArchiveName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    OObject top = archive.getTop();
+
+    AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+    Alembic::Util::uint32_t tsIndex = archive.addTimeSampling( *ts );
+
+    AbcA::MetaData md;
+    md.set( "layer", "over" );
+    OObject a( top, "a", md );
+
+    // x becomes an animated string
+    OStringProperty x( a.getProperties(), "x", tsIndex );
+    x.set( "one" );
+    x.set( "two" );
+
+    OCompoundProperty c( a.getProperties(), "c" );
+    OInt32Property( c, "q" ).set( 2 );
+    OInt32Property( c, "shared" ).set( 2 );
+
+    OObject e( a, "e" );
+
+    AbcA::MetaData pruneMd;
+    AbcL::SetPrune( pruneMd, true );
+    OObject d( top, "d", pruneMd );
+
+    AbcA::MetaData replaceMd;
+    AbcL::SetReplace( replaceMd, true );
+    OObject g( top, "g", replaceMd );
+    OObject i( g, "i" );
+
+    OObject f( top, "f" );
+}
+
+//-*****************************************************************************
+void readLayered( const std::string & iBaseName,
+                  const std::string & iOverName )
+{
+    std::vector< std::string > files;
+    files.push_back( iBaseName );
+    files.push_back( iOverName );
+
+    AbcF::IFactory factory;
+    AbcF::IFactory::CoreType coreType;
+    IArchive archive = factory.getArchive( files, coreType );
+    TESTING_ASSERT( archive.valid() );
+    TESTING_ASSERT( coreType == AbcF::IFactory::kLayer );
+
+    // identity, plus the one from the over
+    TESTING_ASSERT( archive.getNumTimeSamplings() == 2 );
+    TESTING_ASSERT( archive.getMaxNumSamplesForTimeSamplingIndex( 1 ) == 2 );
+
+    IObject top = archive.getTop();
+
+    // d got pruned, f is new, and a and g keep their original spots
+    TESTING_ASSERT( top.getNumChildren() == 3 );
+    TESTING_ASSERT( top.getChildHeader( 0 ).getName() == "a" );
+    TESTING_ASSERT( top.getChildHeader( 1 ).getName() == "g" );
+    TESTING_ASSERT( top.getChildHeader( 2 ).getName() == "f" );
+    TESTING_ASSERT( !top.getChildHeader( "d" ) );
+
+    IObject a( top, "a" );
+    TESTING_ASSERT( a.getMetaData().get( "layer" ) == "over" );
+    TESTING_ASSERT( a.getNumChildren() == 2 );
+    TESTING_ASSERT( a.getChildHeader( 0 ).getName() == "b" );
+    TESTING_ASSERT( a.getChildHeader( 1 ).getName() == "e" );
+    TESTING_ASSERT( a.getChild( "b" ).getFullName() == "/a/b" );
+    TESTING_ASSERT( a.getChild( "b" ).getParent().getPtr() == a.getPtr() );
+    TESTING_ASSERT( a.getArchive().getPtr() == archive.getPtr() );
+
+    ICompoundProperty props = a.getProperties();
+    TESTING_ASSERT( props.getNumProperties() == 2 );
+
+    IStringProperty x( props, "x" );
+    TESTING_ASSERT( x.getNumSamples() == 2 );
+    TESTING_ASSERT( x.getValue( ISampleSelector( ( index_t ) 1 ) ) == "two" );
+
+    ICompoundProperty c( props, "c" );
+    TESTING_ASSERT( c.getNumProperties() == 3 );
+    TESTING_ASSERT( c.getObject().getPtr() == a.getPtr() );
+    TESTING_ASSERT( IInt32Property( c, "p" ).getValue() == 1 );
+    TESTING_ASSERT( IInt32Property( c, "q" ).getValue() == 2 );
+    TESTING_ASSERT( IInt32Property( c, "shared" ).getValue() == 2 );
+
+    // g was replaced, so h is gone
+    IObject g( top, "g" );
+    TESTING_ASSERT( g.getNumChildren() == 1 );
+    TESTING_ASSERT( g.getChildHeader( 0 ).getName() == "i" );
+
+    TESTING_ASSERT( archive.findObject( "/g/i" ).valid() );
+    TESTING_ASSERT( !archive.findObject( "/g/h" ).valid() );
+
+    // the same child comes back while it is still held
+    TESTING_ASSERT( top.getChild( "f" ).getPtr() ==
+                    top.getChild( "f" ).getPtr() );
+
+    // a single file is just that file
+    IArchive single = factory.getArchive(
+        std::vector< std::string >( 1, iBaseName ), coreType );
+    TESTING_ASSERT( coreType == AbcF::IFactory::kOgawa );
+    TESTING_ASSERT( single.getTop().getNumChildren() == 3 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    writeBase( "layerBase.abc" );
+    writeOver( "layerOver.abc" );
+    readLayered( "layerBase.abc", "layerOver.abc" );
+    return 0;
+}
@@ -104,14 +104,93 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+            getObject()->getArchive() );
+    StreamIDPtr streamId = archive->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
+    Ogawa::IDataPtr data = m_group->getData(index, id);
+    const AbcA::DataType &dataType = m_header->header.getDataType();
+
+    // Without a cache (or for empty samples which have no key) just decode.
+    AbcA::ReadArraySampleCachePtr cache =
+        archive->getReadArraySampleCachePtr();
+    if ( !cache || !data || data->getSize() < 16 )
+    {
+        ReadArraySample( dims, data, id, dataType,
+                         archive->getArraySampleAllocator(), oSample );
+        return;
+    }
+
+    // The key only covers the bytes, so a found sample is only shared if
+    // it also agrees in type and shape.  Instanced objects share their
+    // property readers, so every instance lands on the same entry here.
+    AbcA::ArraySampleKey key;
+    key.readPOD = dataType.getPod();
+    key.origPOD = key.readPOD;
+    key.numBytes = data->getSize() - 16;
+    data->read( 16, key.digest.d, 0, id );
+
+    AbcA::ReadArraySampleID found = cache->find( key );
+    if ( found )
+    {
+        Alembic::Util::Dimensions dim;
+        ReadDimensions( dims, data, id, dataType, dim );
+        AbcA::ArraySamplePtr samp = found.getSample();
+        if ( samp->getDataType() == dataType && samp->getDimensions() == dim )
+        {
+            oSample = samp;
+            return;
+        }
+    }
+
+    ReadArraySample( dims, data, id, dataType,
+                     archive->getArraySampleAllocator(), oSample );
+
+    if ( !found )
+    {
+        AbcA::ArraySamplePtr samp = cache->store( key, oSample ).getSample();
+        if ( samp && samp->getDataType() == dataType &&
+             samp->getDimensions() == oSample->getDimensions() )
+        {
+            oSample = samp;
+        }
+    }
+}
+
+//-*****************************************************************************
+void AprImpl::getSampleRange( index_t iSampleIndex,
+                              size_t iElementOffset,
+                              size_t iNumElements,
+                              AbcA::ArraySamplePtr &oSample )
+{
+    const AbcA::DataType &dataType = m_header->header.getDataType();
+
+    // strings are variable length, so we can't seek to an element
+    if ( dataType.getPod() == Alembic::Util::kStringPOD ||
+         dataType.getPod() == Alembic::Util::kWstringPOD )
+    {
+        AbcA::ArrayPropertyReader::getSampleRange( iSampleIndex,
+            iElementOffset, iNumElements, oSample );
+        return;
+    }
+
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+            getObject()->getArchive() );
+    StreamIDPtr streamId = archive->getStreamID();
 
     std::size_t id = streamId->getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    ReadArraySampleRange( dims, data, id, dataType, iElementOffset,
+                          iNumElements, archive->getArraySampleAllocator(),
+                          oSample );
 }
 
 //-*****************************************************************************
@@ -165,6 +244,26 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
     return false;
 }
 
+//-*****************************************************************************
+void AprImpl::getRawData( index_t iSampleIndex,
+                          std::vector< Util::uint8_t > & oData )
+{
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr data = m_group->getData( index, id );
+
+    oData.clear();
+    if ( data && data->getSize() > 16 )
+    {
+        oData.resize( data->getSize() - 16 );
+        data->read( oData.size(), &oData.front(), 16, id );
+    }
+}
+
 //-*****************************************************************************
 bool AprImpl::isScalarLike()
 {
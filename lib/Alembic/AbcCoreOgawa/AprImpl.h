@@ -64,10 +64,18 @@ public:
     virtual bool isConstant();
     virtual void getSample( index_t iSampleIndex,
                             AbcA::ArraySamplePtr &oSample );
+    virtual void getSampleRange( index_t iSampleIndex,
+                                 size_t iElementOffset,
+                                 size_t iNumElements,
+                                 AbcA::ArraySamplePtr &oSample );
     virtual std::pair<index_t, chrono_t> getFloorIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getCeilIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime );
     virtual bool getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey );
+
+    // Reads the stored bytes of a sample, without the key in front of them
+    void getRawData( index_t iSampleIndex,
+                     std::vector< Util::uint8_t > & oData );
     virtual void getDimensions( index_t iSampleIndex,
                                 Alembic::Util::Dimensions & oDim );
     virtual bool isScalarLike();
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
+#include <Alembic/AbcCoreOgawa/AprImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
@@ -129,15 +130,6 @@ void ApwImpl::setFromPreviousSample()
 //-*****************************************************************************
 void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 {
-    // Make sure we aren't writing more samples than we have times for
-    // This applies to acyclic sampling only
-    ABCA_ASSERT(
-        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
-        || m_header->header.getTimeSampling()->getNumStoredTimes() >
-        m_header->nextSampleIndex,
-        "Can not write more samples than we have times for when using "
-        "Acyclic sampling." );
-
     ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
         "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
         ", does not match the DataType of the Array property: " <<
@@ -157,6 +149,67 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         key.readPOD = Alembic::Util::kInt8POD;
     }
 
+    writeSample( key, iSamp.getDimensions(), &iSamp, NULL, 0 );
+}
+
+//-*****************************************************************************
+void ApwImpl::setSampleFrom( AbcA::ArrayPropertyReaderPtr iReader,
+                             index_t iSampleIndex )
+{
+    ABCA_ASSERT( iReader, "Invalid ArrayPropertyReader" );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ABCA_ASSERT( iReader->getDataType() == dataType,
+        "DataType of the source: " << iReader->getDataType() <<
+        ", does not match the DataType of the Array property: " <<
+        dataType );
+
+    // The key of a string sample depends on the in memory strings, so only
+    // other data can be transferred as it is stored.
+    Alembic::Util::shared_ptr< AprImpl > reader =
+        Alembic::Util::dynamic_pointer_cast< AprImpl,
+            AbcA::ArrayPropertyReader >( iReader );
+
+    AbcA::ArraySample::Key key;
+    if ( !reader || dataType.getPod() == Alembic::Util::kStringPOD ||
+         dataType.getPod() == Alembic::Util::kWstringPOD ||
+         !reader->getKey( iSampleIndex, key ) )
+    {
+        AbcA::ArrayPropertyWriter::setSampleFrom( iReader, iSampleIndex );
+        return;
+    }
+
+    // same masking as setSample
+    key.origPOD = Alembic::Util::kInt8POD;
+    key.readPOD = Alembic::Util::kInt8POD;
+
+    AbcA::Dimensions dims;
+    reader->getDimensions( iSampleIndex, dims );
+
+    writeSample( key, dims, NULL, reader.get(), iSampleIndex );
+}
+
+//-*****************************************************************************
+// Either iSamp is given, or the stored sample iRawIndex of iRawReader which
+// is only read if data with the same key hasn't been written already.
+void ApwImpl::writeSample( const AbcA::ArraySample::Key & iKey,
+                           const AbcA::Dimensions & iDims,
+                           const AbcA::ArraySample * iSamp,
+                           AprImpl * iRawReader,
+                           index_t iRawIndex )
+{
+    // Make sure we aren't writing more samples than we have times for
+    // This applies to acyclic sampling only
+    ABCA_ASSERT(
+        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
+        || m_header->header.getTimeSampling()->getNumStoredTimes() >
+        m_header->nextSampleIndex,
+        "Can not write more samples than we have times for when using "
+        "Acyclic sampling." );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    AbcA::ArraySample::Key key = iKey;
+
     // We need to write the sample
     if ( m_header->nextSampleIndex == 0  ||
          !( m_previousWrittenSampleID &&
@@ -172,22 +225,40 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
             {
                 assert( smpI > 0 );
                 CopyWrittenData( m_group, m_previousWrittenSampleID );
-                WriteDimensions( m_group, m_dims,
-                                 iSamp.getDataType().getPod() );
+                WriteDimensions( m_group, m_dims, dataType.getPod() );
             }
         }
 
         // Write this sample, which will update its internal
         // cache of what the previously written sample was.
         AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+        WrittenSampleMap & sampleMap = GetWrittenSampleMap( awp );
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( iSamp )
+        {
+            m_previousWrittenSampleID =
+                WriteData( sampleMap, m_group, *iSamp, key );
+        }
+        else
+        {
+            m_previousWrittenSampleID = sampleMap.find( key );
+            if ( m_previousWrittenSampleID )
+            {
+                CopyWrittenData( m_group, m_previousWrittenSampleID );
+            }
+            else
+            {
+                std::vector< Util::uint8_t > data;
+                iRawReader->getRawData( iRawIndex, data );
+                m_previousWrittenSampleID = WriteRawData( sampleMap, m_group,
+                    key, data, dataType.getExtent() * iDims.numPoints() );
+            }
+        }
 
-        m_dims = iSamp.getDimensions();
-        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
+        m_dims = iDims;
+        WriteDimensions( m_group, m_dims, dataType.getPod() );
 
         // if we haven't written this already, isScalarLike will be true
         if ( m_header->isScalarLike && m_dims.numPoints() != 1 )
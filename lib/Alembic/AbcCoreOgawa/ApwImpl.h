@@ -44,6 +44,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class AprImpl;
+
 //-*****************************************************************************
 class ApwImpl
     : public AbcA::ArrayPropertyWriter
@@ -66,6 +68,8 @@ public:
     // ArrayPropertyWriter overrides
     virtual void setSample( const AbcA::ArraySample & iSamp );
     virtual void setFromPreviousSample();
+    virtual void setSampleFrom( AbcA::ArrayPropertyReaderPtr iReader,
+                                index_t iSampleIndex );
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
 
@@ -79,6 +83,12 @@ protected:
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
 private:
+    void writeSample( const AbcA::ArraySample::Key & iKey,
+                      const AbcA::Dimensions & iDims,
+                      const AbcA::ArraySample * iSamp,
+                      AprImpl * iRawReader,
+                      index_t iRawIndex );
+
     // The parent compound property writer.
     AbcA::CompoundPropertyWriterPtr m_parent;
 
@@ -79,12 +79,36 @@ public:
 
     virtual AbcA::ReadArraySampleCachePtr getReadArraySampleCachePtr()
     {
-        return AbcA::ReadArraySampleCachePtr();
+        return m_cachePtr;
     }
 
+    //! THIS METHOD IS NOT MULTITHREAD SAFE
+    //! Samples are read from multiple threads, so only a
+    //! SharedReadArraySampleCache is used, any other cache is ignored.
     virtual void
     setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     {
+        if ( Alembic::Util::dynamic_pointer_cast<
+                AbcA::SharedReadArraySampleCache >( iPtr ) )
+        {
+            m_cachePtr = iPtr;
+        }
+        else
+        {
+            m_cachePtr.reset();
+        }
+    }
+
+    virtual AbcA::ArraySampleAllocatorPtr getArraySampleAllocator()
+    {
+        return m_allocator;
+    }
+
+    //! THIS METHOD IS NOT MULTITHREAD SAFE
+    virtual void
+    setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iPtr )
+    {
+        m_allocator = iPtr;
     }
 
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
@@ -126,6 +150,10 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    AbcA::ArraySampleAllocatorPtr m_allocator;
+
+    AbcA::ReadArraySampleCachePtr m_cachePtr;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -1426,19 +1426,57 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
+                 AbcA::ArraySampleAllocatorPtr iAllocator,
                  AbcA::ArraySamplePtr &oSample )
 {
     // get our dimensions
     Util::Dimensions dims;
     ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
 
-    oSample = AbcA::AllocateArraySample( iDataType, dims );
+    oSample = AbcA::AllocateArraySample( iDataType, dims, iAllocator );
 
     ReadData( const_cast<void*>( oSample->getData() ), iData,
         iThreadId, iDataType, iDataType.getPod() );
 
 }
 
+//-*****************************************************************************
+void
+ReadArraySampleRange( Ogawa::IDataPtr iDims,
+                      Ogawa::IDataPtr iData,
+                      size_t iThreadId,
+                      const AbcA::DataType &iDataType,
+                      size_t iElementOffset,
+                      size_t iNumElements,
+                      AbcA::ArraySampleAllocatorPtr iAllocator,
+                      AbcA::ArraySamplePtr &oSample )
+{
+    assert( iDataType.getPod() != Alembic::Util::kStringPOD &&
+            iDataType.getPod() != Alembic::Util::kWstringPOD );
+
+    Util::Dimensions dims;
+    ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
+
+    ABCA_ASSERT( iElementOffset + iNumElements <= dims.numPoints(),
+                 "Invalid range: " << iElementOffset << ", " << iNumElements
+                 << " for a sample of " << dims.numPoints() << " elements." );
+
+    oSample = AbcA::AllocateArraySample( iDataType,
+                                         Util::Dimensions( iNumElements ),
+                                         iAllocator );
+
+    if ( iNumElements == 0 )
+    {
+        return;
+    }
+
+    // + 16 to skip the key
+    std::size_t numBytes = iDataType.getNumBytes();
+    iData->read( iNumElements * numBytes,
+                 const_cast< void * >( oSample->getData() ),
+                 16 + iElementOffset * numBytes, iThreadId );
+}
+
 //-*****************************************************************************
 void
 ReadTimeSamplesAndMax( Ogawa::IDataPtr iData,
@@ -1525,7 +1563,7 @@ ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
             std::string metaData( &buf[pos], metaDataSize );
             pos += metaDataSize;
 
-            objPtr->getMetaData().deserialize( metaData );
+            objPtr->getMetaData().deserializeDeferred( metaData );
         }
         else
         {
@@ -1715,7 +1753,7 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
             pos += metaDataSize;
 
             AbcA::MetaData md;
-            md.deserialize( metaData );
+            md.deserializeDeferred( metaData );
             header->header.setMetaData( md );
         }
         else
@@ -1746,6 +1784,7 @@ ReadIndexedMetaData( Ogawa::IDataPtr iData,
         Util::uint8_t metaDataSize = buf[pos++];
         std::string metaData( &buf[pos], metaDataSize );
         pos += metaDataSize;
+        // parsed once here, since these are shared by many headers
         AbcA::MetaData md;
         md.deserialize( metaData );
         oMetaDataVec.push_back( md );
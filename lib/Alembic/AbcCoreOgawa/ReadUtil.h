@@ -70,8 +70,22 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
+                 AbcA::ArraySampleAllocatorPtr iAllocator,
                  AbcA::ArraySamplePtr &oSample );
 
+//-*****************************************************************************
+// Reads iNumElements elements starting at iElementOffset, only the bytes of
+// the range are read from the stream.  Not suitable for string and wstring.
+void
+ReadArraySampleRange( Ogawa::IDataPtr iDims,
+                      Ogawa::IDataPtr iData,
+                      size_t iThreadId,
+                      const AbcA::DataType &iDataType,
+                      size_t iElementOffset,
+                      size_t iNumElements,
+                      AbcA::ArraySampleAllocatorPtr iAllocator,
+                      AbcA::ArraySamplePtr &oSample );
+
 //-*****************************************************************************
 void
 ReadTimeSamplesAndMax( Ogawa::IDataPtr iData,
@@ -106,7 +106,9 @@ ReadArchive::operator()( const std::string &iFileName ) const
 }
 
 //-*****************************************************************************
-// The given cache is ignored.
+// Array samples are shared through the given cache, but only if it is an
+// AbcA::SharedReadArraySampleCache since samples are read from multiple
+// threads.  Any other cache is ignored.
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
@@ -123,6 +125,7 @@ ReadArchive::operator()( const std::string &iFileName,
         archivePtr = Alembic::Util::shared_ptr<ArImpl> (
             new ArImpl( m_streams ) );
     }
+    archivePtr->setReadArraySampleCachePtr( iCache );
     return archivePtr;
 }
 
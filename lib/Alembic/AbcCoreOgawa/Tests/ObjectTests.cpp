@@ -291,9 +291,17 @@ void testMetaData()
         AbcA::ObjectReaderPtr child = archive->getChild(0);
         for (std::size_t i = 0; i < 300; ++i)
         {
-            AbcA::ObjectReaderPtr grandChild = child->getChild(i);
             std::stringstream strm;
             strm << i;
+
+            // the header MetaData isn't parsed until it is needed, copies
+            // taken before then still have to hold the same contents
+            AbcA::MetaData copied = child->getChildHeader(i).getMetaData();
+            TESTING_ASSERT(copied.serialize() == strm.str() + "=" + strm.str());
+            TESTING_ASSERT(copied.size() == 1);
+            TESTING_ASSERT(copied.get(strm.str()) == strm.str());
+
+            AbcA::ObjectReaderPtr grandChild = child->getChild(i);
             TESTING_ASSERT(grandChild->getName() == strm.str());
             TESTING_ASSERT(grandChild->getMetaData().get(strm.str())
                            == strm.str());
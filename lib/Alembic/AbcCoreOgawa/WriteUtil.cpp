@@ -273,6 +273,25 @@ WriteData( WrittenSampleMap &iMap,
     return writeID;
 }
 
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteRawData( WrittenSampleMap &iMap,
+              Ogawa::OGroupPtr iGroup,
+              const AbcA::ArraySample::Key &iKey,
+              const std::vector< Util::uint8_t > &iData,
+              std::size_t iNumPoints )
+{
+    const void * datas[2] = { &iKey.digest,
+                              iData.empty() ? NULL : &iData.front() };
+    Alembic::Util::uint64_t sizes[2] = { 16, iData.size() };
+    Ogawa::ODataPtr dataPtr = iGroup->addData( 2, sizes, datas );
+
+    WrittenSampleIDPtr writeID(
+        new WrittenSampleID( iKey, dataPtr, iNumPoints ) );
+    iMap.store( writeID );
+    return writeID;
+}
+
 //-*****************************************************************************
 void CopyWrittenData( Ogawa::OGroupPtr iGroup,
                       WrittenSampleIDPtr iRef )
@@ -77,6 +77,16 @@ WriteData( WrittenSampleMap &iMap,
            const AbcA::ArraySample &iSamp,
            const AbcA::ArraySample::Key &iKey );
 
+//-*****************************************************************************
+// Writes data which is already laid out the way Ogawa stores it, along with
+// its known key.
+WrittenSampleIDPtr
+WriteRawData( WrittenSampleMap &iMap,
+              Ogawa::OGroupPtr iGroup,
+              const AbcA::ArraySample::Key &iKey,
+              const std::vector< Util::uint8_t > &iData,
+              std::size_t iNumPoints );
+
 //-*****************************************************************************
 void
 WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
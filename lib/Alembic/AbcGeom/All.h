@@ -38,6 +38,7 @@
 #define _Alembic_AbcGeom_All_h_
 
 #include <Alembic/AbcGeom/ArchiveBounds.h>
+#include <Alembic/AbcGeom/ExpandedSampleCache.h>
 
 #include <Alembic/AbcGeom/GeometryScope.h>
 
@@ -79,6 +80,10 @@
 #include <Alembic/AbcGeom/XformSample.h>
 #include <Alembic/AbcGeom/OXform.h>
 #include <Alembic/AbcGeom/IXform.h>
+#include <Alembic/AbcGeom/FlattenedHierarchy.h>
+#include <Alembic/AbcGeom/WorldXformCache.h>
+#include <Alembic/AbcGeom/Interpolation.h>
+#include <Alembic/AbcGeom/SpatialIndex.h>
 
 #include <Alembic/AbcGeom/Visibility.h>
 
@@ -0,0 +1,154 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/ExpandedSampleCache.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+struct ExpandedKey
+{
+    AbcA::ArraySampleKey values;
+    AbcA::ArraySampleKey indices;
+    std::string type;
+
+    bool operator<( const ExpandedKey & iRhs ) const
+    {
+        if ( values != iRhs.values )
+        {
+            return values < iRhs.values;
+        }
+
+        if ( indices != iRhs.indices )
+        {
+            return indices < iRhs.indices;
+        }
+
+        return type < iRhs.type;
+    }
+};
+
+typedef std::map< ExpandedKey, Alembic::Util::weak_ptr< AbcA::ArraySample > >
+    ExpandedMap;
+
+static const size_t kMIN_SWEEP_SIZE = 256;
+
+static Alembic::Util::mutex g_expandedLock;
+static ExpandedMap g_expanded;
+static size_t g_sweepSize = kMIN_SWEEP_SIZE;
+
+//-*****************************************************************************
+ExpandedKey makeKey( const AbcA::ArraySampleKey & iValuesKey,
+                     const AbcA::ArraySampleKey & iIndicesKey,
+                     const std::string & iType )
+{
+    ExpandedKey key;
+    key.values = iValuesKey;
+    key.indices = iIndicesKey;
+    key.type = iType;
+    return key;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+GetCachedExpandedSample( const AbcA::ArraySampleKey & iValuesKey,
+                         const AbcA::ArraySampleKey & iIndicesKey,
+                         const std::string & iType )
+{
+    ExpandedKey key = makeKey( iValuesKey, iIndicesKey, iType );
+
+    Alembic::Util::scoped_lock l( g_expandedLock );
+
+    ExpandedMap::iterator it = g_expanded.find( key );
+    if ( it == g_expanded.end() )
+    {
+        return AbcA::ArraySamplePtr();
+    }
+
+    return it->second.lock();
+}
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+CacheExpandedSample( const AbcA::ArraySampleKey & iValuesKey,
+                     const AbcA::ArraySampleKey & iIndicesKey,
+                     const std::string & iType,
+                     AbcA::ArraySamplePtr iSample )
+{
+    ExpandedKey key = makeKey( iValuesKey, iIndicesKey, iType );
+
+    Alembic::Util::scoped_lock l( g_expandedLock );
+
+    Alembic::Util::weak_ptr< AbcA::ArraySample > & entry = g_expanded[key];
+    AbcA::ArraySamplePtr ret = entry.lock();
+    if ( ret )
+    {
+        return ret;
+    }
+
+    entry = iSample;
+
+    // let the map double before looking for entries that have gone away
+    if ( g_expanded.size() > g_sweepSize )
+    {
+        ExpandedMap::iterator it = g_expanded.begin();
+        while ( it != g_expanded.end() )
+        {
+            if ( it->second.expired() )
+            {
+                g_expanded.erase( it++ );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        g_sweepSize = std::max( kMIN_SWEEP_SIZE, 2 * g_expanded.size() );
+    }
+
+    return iSample;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
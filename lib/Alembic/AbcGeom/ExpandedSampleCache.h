@@ -0,0 +1,104 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_ExpandedSampleCache_h_
+#define _Alembic_AbcGeom_ExpandedSampleCache_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Expanded samples of indexed geom params (see ITypedGeomParam::getExpanded)
+//! are shared through a process wide cache, so that the same values and
+//! indices, whether from another frame or another object, only get
+//! expanded and stored once.  The cache only holds weak references, an
+//! entry goes away once the last user of its sample lets go of it.
+//!
+//! iType tells apart expansions which have the same bytes but not the
+//! same sample type.
+
+//! Returns the cached expansion, or a NULL pointer if there isn't one.
+ALEMBIC_EXPORT AbcA::ArraySamplePtr
+GetCachedExpandedSample( const AbcA::ArraySampleKey & iValuesKey,
+                         const AbcA::ArraySampleKey & iIndicesKey,
+                         const std::string & iType );
+
+//! Adds iSample to the cache and returns it, unless another thread got there
+//! first in which case the sample that is already cached is returned.
+ALEMBIC_EXPORT AbcA::ArraySamplePtr
+CacheExpandedSample( const AbcA::ArraySampleKey & iValuesKey,
+                     const AbcA::ArraySampleKey & iIndicesKey,
+                     const std::string & iType,
+                     AbcA::ArraySamplePtr iSample );
+
+//-*****************************************************************************
+//! oVals[i] = iVals[iIndices[i]] for each of the iNumIndices indices, all of
+//! the indices are checked against iNumVals before anything is written.
+template <class T>
+void ExpandIndexed( const T * iVals, size_t iNumVals,
+                    const Alembic::Util::uint32_t * iIndices,
+                    size_t iNumIndices,
+                    T * oVals )
+{
+    // done as its own pass so the gather below stays a plain loop
+    Alembic::Util::uint32_t maxIndex = 0;
+    for ( size_t i = 0; i < iNumIndices; ++i )
+    {
+        maxIndex = std::max( maxIndex, iIndices[i] );
+    }
+
+    ABCA_ASSERT( iNumIndices == 0 || maxIndex < iNumVals,
+                 "Index " << maxIndex << " out of range for " << iNumVals
+                 << " values" );
+
+    for ( size_t i = 0; i < iNumIndices; ++i )
+    {
+        oVals[i] = iVals[ iIndices[i] ];
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
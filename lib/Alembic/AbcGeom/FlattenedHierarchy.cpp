@@ -0,0 +1,97 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/FlattenedHierarchy.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+const size_t FlattenedHierarchy::kInvalidIndex = ( size_t ) -1;
+
+//-*****************************************************************************
+void FlattenedHierarchy::flatten( const Abc::IObject & iRoot )
+{
+    if ( !iRoot.valid() )
+    {
+        return;
+    }
+
+    // depth first, with our own stack since hierarchies can be very deep,
+    // so that parents always end up before their children
+    std::vector< std::pair< Abc::IObject, size_t > > stack;
+    stack.push_back( std::make_pair( iRoot, kInvalidIndex ) );
+
+    while ( !stack.empty() )
+    {
+        Abc::IObject obj = stack.back().first;
+        size_t parent = stack.back().second;
+        stack.pop_back();
+
+        size_t index = m_objects.size();
+        m_objects.push_back( obj );
+        m_parents.push_back( parent );
+        m_indices[obj.getFullName()] = index;
+
+        if ( !addObject( obj, index, parent ) )
+        {
+            continue;
+        }
+
+        for ( size_t i = obj.getNumChildren(); i > 0; --i )
+        {
+            stack.push_back( std::make_pair( obj.getChild( i - 1 ), index ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+size_t FlattenedHierarchy::getIndex( const std::string & iFullName ) const
+{
+    std::map< std::string, size_t >::const_iterator it =
+        m_indices.find( iFullName );
+
+    if ( it == m_indices.end() )
+    {
+        return kInvalidIndex;
+    }
+
+    return it->second;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
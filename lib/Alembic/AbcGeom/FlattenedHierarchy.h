@@ -0,0 +1,100 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_FlattenedHierarchy_h_
+#define _Alembic_AbcGeom_FlattenedHierarchy_h_
+
+#include <map>
+#include <vector>
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The objects under a root, flattened into an array so that every object
+//! gets an index and a parent always comes before its children.  This is
+//! what WorldXformCache and VisibilityCache are built on.
+class ALEMBIC_EXPORT FlattenedHierarchy
+{
+public:
+    //! Returned by getIndex for names that aren't in the hierarchy, and by
+    //! getParentIndex for the root.
+    static const size_t kInvalidIndex;
+
+    FlattenedHierarchy() {}
+
+    virtual ~FlattenedHierarchy() {}
+
+    size_t getNumObjects() const { return m_objects.size(); }
+
+    size_t getParentIndex( size_t iIndex ) const { return m_parents[iIndex]; }
+
+    const Abc::IObject & getObject( size_t iIndex ) const
+    { return m_objects[iIndex]; }
+
+    const std::string & getFullName( size_t iIndex ) const
+    { return m_objects[iIndex].getFullName(); }
+
+    //! Returns the index of the object with this full name, or kInvalidIndex.
+    size_t getIndex( const std::string & iFullName ) const;
+
+protected:
+    //! Walks the hierarchy under iRoot depth first, calling addObject on
+    //! every object after it has been given its index.
+    void flatten( const Abc::IObject & iRoot );
+
+    //! Called once per object, in parent before child order.  The children
+    //! of the object are only walked if this returns true.
+    virtual bool addObject( const Abc::IObject & iObject, size_t iIndex,
+                            size_t iParent ) = 0;
+
+    std::vector< Abc::IObject > m_objects;
+    std::vector< size_t > m_parents;
+
+    std::map< std::string, size_t > m_indices;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,187 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/Util/Threads.h>
+
+#include <limits>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// below this many positions per thread it isn't worth starting one
+static const size_t kMIN_POSITIONS_PER_THREAD = 1 << 18;
+
+static const float kINF = std::numeric_limits< float >::infinity();
+
+//-*****************************************************************************
+struct BoundsRange
+{
+    float min[3];
+    float max[3];
+};
+
+struct BoundsReduction
+{
+    const float * positions;
+    std::vector< BoundsRange > ranges;
+};
+
+//-*****************************************************************************
+// The min and max are kept in float and per component, written so that
+// the compiler can turn it into min/max instructions instead of branching.
+// NaN components never compare smaller or bigger, and so get skipped just
+// like Box3d::extendBy does.
+void reduceBounds( size_t iRange, size_t iBegin, size_t iEnd,
+                   void * iReduction )
+{
+    BoundsReduction & reduction =
+        *static_cast< BoundsReduction * >( iReduction );
+    BoundsRange & range = reduction.ranges[iRange];
+
+    float mn0 = kINF, mn1 = kINF, mn2 = kINF;
+    float mx0 = -kINF, mx1 = -kINF, mx2 = -kINF;
+
+    const float * p = reduction.positions + 3 * iBegin;
+    const float * end = reduction.positions + 3 * iEnd;
+    for ( ; p != end; p += 3 )
+    {
+        mn0 = p[0] < mn0 ? p[0] : mn0;
+        mx0 = p[0] > mx0 ? p[0] : mx0;
+        mn1 = p[1] < mn1 ? p[1] : mn1;
+        mx1 = p[1] > mx1 ? p[1] : mx1;
+        mn2 = p[2] < mn2 ? p[2] : mn2;
+        mx2 = p[2] > mx2 ? p[2] : mx2;
+    }
+
+    range.min[0] = mn0; range.min[1] = mn1; range.min[2] = mn2;
+    range.max[0] = mx0; range.max[1] = mx1; range.max[2] = mx2;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Abc::Box3d ComputeBoundsFromPositions( const Abc::V3f * iPositions,
+                                       size_t iNumPositions,
+                                       size_t iNumThreads )
+{
+    Abc::Box3d ret;
+    if ( iNumPositions == 0 || !iPositions )
+    {
+        return ret;
+    }
+
+    size_t numRanges = Util::GetNumRanges( iNumPositions, iNumThreads,
+                                           kMIN_POSITIONS_PER_THREAD );
+
+    // V3f is three packed floats
+    BoundsReduction reduction;
+    reduction.positions = &( iPositions[0].x );
+    reduction.ranges.resize( numRanges );
+    Util::ParallelRanges( iNumPositions, numRanges, reduceBounds, &reduction );
+
+    float mn[3] = { kINF, kINF, kINF };
+    float mx[3] = { -kINF, -kINF, -kINF };
+    for ( size_t i = 0; i < numRanges; ++i )
+    {
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            mn[j] = std::min( mn[j], reduction.ranges[i].min[j] );
+            mx[j] = std::max( mx[j], reduction.ranges[i].max[j] );
+        }
+    }
+
+    // widening after the reduction gives the same answer as widening each
+    // position, components without a single valid value stay empty
+    for ( size_t j = 0; j < 3; ++j )
+    {
+        if ( mn[j] <= mx[j] )
+        {
+            ret.min[j] = mn[j];
+            ret.max[j] = mx[j];
+        }
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+bool BoundsIntersectFrustum( const Abc::Box3d &iBounds,
+                             const Abc::M44d &iWorldToClip )
+{
+    if ( iBounds.isEmpty() )
+    {
+        return false;
+    }
+
+    // the 6 planes are -w <= x, x <= w, and so on
+    int inside[6] = { 0, 0, 0, 0, 0, 0 };
+    for ( int c = 0; c < 8; ++c )
+    {
+        Abc::V3d p( ( c & 1 ) ? iBounds.max.x : iBounds.min.x,
+                    ( c & 2 ) ? iBounds.max.y : iBounds.min.y,
+                    ( c & 4 ) ? iBounds.max.z : iBounds.min.z );
+
+        double clip[4];
+        for ( int j = 0; j < 4; ++j )
+        {
+            clip[j] = p.x * iWorldToClip[0][j] + p.y * iWorldToClip[1][j] +
+                p.z * iWorldToClip[2][j] + iWorldToClip[3][j];
+        }
+
+        for ( int j = 0; j < 3; ++j )
+        {
+            if ( clip[j] >= -clip[3] ) { ++inside[2 * j]; }
+            if ( clip[j] <= clip[3] ) { ++inside[2 * j + 1]; }
+        }
+    }
+
+    for ( int i = 0; i < 6; ++i )
+    {
+        if ( inside[i] == 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
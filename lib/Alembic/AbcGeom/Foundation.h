@@ -133,8 +133,23 @@ inline void SetPropUsePrevIfNull<Abc::OBox3dProperty, Abc::Box3d>(
 }
 
 //-*****************************************************************************
+//! Computes an axis-aligned bounding box from iNumPositions positions.
+//! The work is split across iNumThreads threads, 0 only goes parallel for
+//! samples of a million or so positions.
+ALEMBIC_EXPORT Abc::Box3d
+ComputeBoundsFromPositions( const Abc::V3f * iPositions,
+                            size_t iNumPositions,
+                            size_t iNumThreads = 0 );
+
 //! This utility function computes an axis-aligned bounding box from a
 //! positions sample
+inline Abc::Box3d ComputeBoundsFromPositions( const Abc::P3fArraySample &iSamp )
+{
+    return ComputeBoundsFromPositions( iSamp.get(), iSamp.size() );
+}
+
+//! This utility function computes an axis-aligned bounding box from a
+//! positions sample of any other type
 template <class ARRAYSAMP>
 static Abc::Box3d ComputeBoundsFromPositions( const ARRAYSAMP &iSamp )
 {
@@ -148,6 +163,15 @@ static Abc::Box3d ComputeBoundsFromPositions( const ARRAYSAMP &iSamp )
     return ret;
 }
 
+//-*****************************************************************************
+//! Returns true if iBounds is at least partly inside the frustum of
+//! iWorldToClip, which goes from world space to clip space
+//! (-w <= x, y, z <= w).  It is conservative, a box is only outside when all
+//! of its corners are on the outside of the same clip plane.
+ALEMBIC_EXPORT bool
+BoundsIntersectFrustum( const Abc::Box3d &iBounds,
+                        const Abc::M44d &iWorldToClip );
+
 //-*****************************************************************************
 //! used in xform rotation conversion
 inline double DegreesToRadians( double iDegrees )
@@ -39,6 +39,9 @@
 
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/GeometryScope.h>
+#include <Alembic/AbcGeom/ExpandedSampleCache.h>
+
+#include <typeinfo>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -362,6 +365,28 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
     }
     else
     {
+        typedef Abc::TypedArraySample<TRAITS> samp_type;
+
+        // the same values and indices (another frame, another object)
+        // share a single expanded sample, which needs neither to be read
+        AbcA::ArraySampleKey valKey;
+        AbcA::ArraySampleKey idxKey;
+        bool haveKeys = m_valProp.getKey( valKey, iSS ) &&
+            m_indicesProperty.getKey( idxKey, iSS );
+
+        const std::string type = typeid( TRAITS ).name();
+        if ( haveKeys )
+        {
+            AbcA::ArraySamplePtr cached =
+                GetCachedExpandedSample( valKey, idxKey, type );
+            if ( cached )
+            {
+                oSamp.m_vals =
+                    Alembic::Util::static_pointer_cast<samp_type>( cached );
+                return;
+            }
+        }
+
         Abc::UInt32ArraySamplePtr idxPtr = m_indicesProperty.getValue( iSS );
 
         size_t size = idxPtr->size();
@@ -373,27 +398,32 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
             return;
         }
 
-        Alembic::Util::shared_ptr< Abc::TypedArraySample<TRAITS> > valPtr = \
+        Alembic::Util::shared_ptr< samp_type > valPtr =
             m_valProp.getValue( iSS );
 
         typename TRAITS::value_type *v = new typename TRAITS::value_type[size];
 
-        for ( size_t i = 0 ; i < size ; ++i )
+        try
         {
-            v[i] = (*valPtr)[ (*idxPtr)[i] ];
+            ExpandIndexed( valPtr->get(), valPtr->size(), idxPtr->get(),
+                           size, v );
+        }
+        catch ( ... )
+        {
+            delete [] v;
+            throw;
         }
-
-        // NOTE: we could create an ArraySampleKey and insert this into the
-        // cache.  If it were in the cache, we'd return the shared pointer
-        // from there and call delete[] on v, thus preventing potentially
-        // unbounded heap growth.  We should probably do this, but for now,
-        // we'll assume that we don't have too many of these, and we're not
-        // tightly memory-constrained. Ha!
 
         const Alembic::Util::Dimensions dims( size );
 
-        oSamp.m_vals.reset( new Abc::TypedArraySample<TRAITS>( v, dims ),
+        oSamp.m_vals.reset( new samp_type( v, dims ),
                             AbcA::TArrayDeleter<typename TRAITS::value_type>());
+
+        if ( haveKeys )
+        {
+            oSamp.m_vals = Alembic::Util::static_pointer_cast<samp_type>(
+                CacheExpandedSample( valKey, idxKey, type, oSamp.m_vals ) );
+        }
     }
 
 }
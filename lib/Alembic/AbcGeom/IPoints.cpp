@@ -36,6 +36,8 @@
 
 #include <Alembic/AbcGeom/IPoints.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
@@ -70,9 +72,290 @@ void IPointsSchema::init( const Abc::Argument &iArg0,
         m_widthsParam = IFloatGeomParam( _this, ".widths", iArg0, iArg1 );
     }
 
+    if ( _this->getPropertyHeader( ".brickBnds" ) != NULL &&
+         _this->getPropertyHeader( ".brickStarts" ) != NULL )
+    {
+        m_brickBoundsProperty = Abc::IBox3fArrayProperty( _this, ".brickBnds",
+                                                          iArg0, iArg1 );
+        m_brickStartsProperty = Abc::IUInt64ArrayProperty( _this,
+            ".brickStarts", iArg0, iArg1 );
+    }
+
+    if ( _this->getPropertyHeader( ".brickOrder" ) != NULL )
+    {
+        m_brickOrderProperty = Abc::IUInt64ArrayProperty( _this,
+            ".brickOrder", iArg0, iArg1 );
+    }
+
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
+namespace {
+
+//-*****************************************************************************
+struct BoxIntersects
+{
+    explicit BoxIntersects( const Abc::Box3d &iRegion ) : region( iRegion ) {}
+
+    bool operator()( const Abc::Box3d &iBounds ) const
+    {
+        return region.intersects( iBounds );
+    }
+
+    Abc::Box3d region;
+};
+
+//-*****************************************************************************
+struct FrustumIntersects
+{
+    explicit FrustumIntersects( const Abc::M44d &iToClip ) : toClip( iToClip )
+    {}
+
+    bool operator()( const Abc::Box3d &iBounds ) const
+    {
+        return BoundsIntersectFrustum( iBounds, toClip );
+    }
+
+    Abc::M44d toClip;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+template <class INTERSECTS>
+void IPointsSchema::getBrickRanges( const INTERSECTS &iIntersects,
+                                    PointRanges &oRanges,
+                                    const Abc::ISampleSelector &iSS ) const
+{
+    oRanges.clear();
+
+    if ( !m_positionsProperty || m_positionsProperty.getNumSamples() == 0 )
+    {
+        return;
+    }
+
+    Alembic::Util::Dimensions dims;
+    m_positionsProperty.getDimensions( dims, iSS );
+    size_t numPoints = dims.numPoints();
+
+    Abc::Box3fArraySamplePtr bricks;
+    Abc::UInt64ArraySamplePtr starts;
+    if ( hasSpatialBricks() )
+    {
+        m_brickBoundsProperty.get( bricks, iSS );
+        m_brickStartsProperty.get( starts, iSS );
+    }
+
+    if ( !bricks || bricks->size() == 0 ||
+         !starts || starts->size() != bricks->size() )
+    {
+        Abc::Box3d bnds;
+        m_selfBoundsProperty.get( bnds, iSS );
+        if ( numPoints > 0 && ( bnds.isEmpty() || iIntersects( bnds ) ) )
+        {
+            oRanges.push_back( std::make_pair( ( size_t ) 0, numPoints ) );
+        }
+        return;
+    }
+
+    for ( size_t i = 0; i < bricks->size(); ++i )
+    {
+        const Abc::Box3f &b = ( *bricks )[i];
+        Abc::Box3d bnds( Abc::V3d( b.min ), Abc::V3d( b.max ) );
+        if ( !iIntersects( bnds ) )
+        {
+            continue;
+        }
+
+        size_t start = ( *starts )[i];
+        size_t end = ( i + 1 < starts->size() ) ? ( *starts )[i + 1] :
+            numPoints;
+        end = std::min( end, numPoints );
+        if ( start >= end )
+        {
+            continue;
+        }
+
+        // neighbouring bricks become one range
+        if ( !oRanges.empty() &&
+             oRanges.back().first + oRanges.back().second == start )
+        {
+            oRanges.back().second += end - start;
+        }
+        else
+        {
+            oRanges.push_back( std::make_pair( start, end - start ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+void IPointsSchema::getBrickRanges( const Abc::Box3d &iRegion,
+                                    PointRanges &oRanges,
+                                    const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getBrickRanges()" );
+
+    getBrickRanges( BoxIntersects( iRegion ), oRanges, iSS );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPointsSchema::getBrickRanges( const Abc::M44d &iToClip,
+                                    PointRanges &oRanges,
+                                    const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getBrickRanges()" );
+
+    getBrickRanges( FrustumIntersects( iToClip ), oRanges, iSS );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+// Reads only the values of iRanges out of iProp, into a new sample.
+template <class PROP>
+static typename PROP::sample_ptr_type
+gatherRanges( const PROP &iProp,
+              const IPointsSchema::PointRanges &iRanges,
+              size_t iNumPoints,
+              const Abc::ISampleSelector &iSS )
+{
+    typedef typename PROP::sample_type sample_type;
+    typedef typename PROP::sample_ptr_type sample_ptr_type;
+    typedef typename sample_type::value_type value_type;
+
+    // the common case of a single range can be handed out as is
+    if ( iRanges.size() == 1 )
+    {
+        size_t start = std::min( iRanges[0].first, iNumPoints );
+        size_t end = std::min( start + iRanges[0].second, iNumPoints );
+        sample_ptr_type ret;
+        iProp.getRange( ret, start, end - start, iSS );
+        return ret;
+    }
+
+    size_t numVals = 0;
+    for ( size_t i = 0; i < iRanges.size(); ++i )
+    {
+        numVals += iRanges[i].second;
+    }
+
+    AbcA::ArraySamplePtr ret = AbcA::AllocateArraySample(
+        iProp.getDataType(), Alembic::Util::Dimensions( numVals ) );
+
+    value_type *dst = const_cast<value_type *>(
+        static_cast<const value_type *>( ret->getData() ) );
+    value_type *first = dst;
+
+    for ( size_t i = 0; i < iRanges.size(); ++i )
+    {
+        size_t start = iRanges[i].first;
+        size_t end = std::min( start + iRanges[i].second, iNumPoints );
+        if ( start < end )
+        {
+            sample_ptr_type range;
+            iProp.getRange( range, start, end - start, iSS );
+            dst = std::copy( range->get(), range->get() + range->size(), dst );
+        }
+    }
+
+    // ranges past the end of the sample leave us with fewer values
+    if ( static_cast<size_t>( dst - first ) != numVals )
+    {
+        AbcA::ArraySamplePtr shrunk = AbcA::AllocateArraySample(
+            iProp.getDataType(), Alembic::Util::Dimensions( dst - first ) );
+        std::copy( first, dst, const_cast<value_type *>(
+            static_cast<const value_type *>( shrunk->getData() ) ) );
+        ret = shrunk;
+    }
+
+    return Alembic::Util::static_pointer_cast<sample_type, AbcA::ArraySample>(
+        ret );
+}
+
+//-*****************************************************************************
+void IPointsSchema::getRanges( Sample &oSample,
+                               const PointRanges &iRanges,
+                               const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getRanges()" );
+
+    oSample.reset();
+
+    Alembic::Util::Dimensions dims;
+    m_positionsProperty.getDimensions( dims, iSS );
+    size_t numPoints = dims.numPoints();
+
+    oSample.m_positions = gatherRanges( m_positionsProperty, iRanges,
+                                        numPoints, iSS );
+
+    oSample.m_ids = gatherRanges( m_idsProperty, iRanges, numPoints, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        m_velocitiesProperty.getDimensions( dims, iSS );
+        if ( dims.numPoints() == numPoints )
+        {
+            oSample.m_velocities = gatherRanges( m_velocitiesProperty,
+                                                 iRanges, numPoints, iSS );
+        }
+    }
+
+    oSample.m_selfBounds = ComputeBoundsFromPositions(
+        *oSample.m_positions );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPointsSchema::getSortOrder( Abc::UInt64ArraySamplePtr &oOrder,
+                                  const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getSortOrder()" );
+
+    oOrder.reset();
+    if ( m_brickOrderProperty && m_brickOrderProperty.getNumSamples() > 0 )
+    {
+        m_brickOrderProperty.get( oOrder, iSS );
+    }
+
+    if ( !oOrder )
+    {
+        oOrder = Abc::UInt64ArraySamplePtr( new Abc::UInt64ArraySample() );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPointsSchema::getSortOrder( Abc::UInt64ArraySamplePtr &oOrder,
+                                  const PointRanges &iRanges,
+                                  const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getSortOrder()" );
+
+    oOrder.reset();
+    if ( m_brickOrderProperty && m_brickOrderProperty.getNumSamples() > 0 )
+    {
+        Alembic::Util::Dimensions dims;
+        m_brickOrderProperty.getDimensions( dims, iSS );
+        if ( dims.numPoints() > 0 )
+        {
+            oOrder = gatherRanges( m_brickOrderProperty, iRanges,
+                                   dims.numPoints(), iSS );
+        }
+    }
+
+    if ( !oOrder )
+    {
+        oOrder = Abc::UInt64ArraySamplePtr( new Abc::UInt64ArraySample() );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -198,6 +198,83 @@ public:
         return smp;
     }
 
+    //-*************************************************************************
+    // SPATIAL QUERIES
+    //-*************************************************************************
+
+    //! Ranges of points, as the index of the first point and how many
+    //! points there are.
+    typedef std::vector< std::pair<size_t, size_t> > PointRanges;
+
+    //! Whether the points were sorted into bricks when they were written,
+    //! see OPointsSchema::setSpatialBrickSize.
+    bool hasSpatialBricks() const
+    {
+        return m_brickBoundsProperty.valid() && m_brickStartsProperty.valid();
+    }
+
+    //! Fills oRanges with the points of the bricks whose bounds intersect
+    //! iRegion.  Samples which weren't split into bricks are a single
+    //! range covering every point, if their self bounds intersect iRegion.
+    void getBrickRanges( const Abc::Box3d &iRegion,
+                         PointRanges &oRanges,
+                         const Abc::ISampleSelector &iSS =
+                         Abc::ISampleSelector() ) const;
+
+    //! Same as above, for the bricks that are at least partly inside the
+    //! frustum of iToClip, which goes from the space of the points to clip
+    //! space (-w <= x, y, z <= w).
+    void getBrickRanges( const Abc::M44d &iToClip,
+                         PointRanges &oRanges,
+                         const Abc::ISampleSelector &iSS =
+                         Abc::ISampleSelector() ) const;
+
+    //! Fills oSample with only the points in iRanges.  The self bounds are
+    //! those of the points which were read.
+    void getRanges( Sample &oSample,
+                    const PointRanges &iRanges,
+                    const Abc::ISampleSelector &iSS =
+                    Abc::ISampleSelector() ) const;
+
+    //! Fills oSample with the points of the bricks which intersect iRegion,
+    //! which can include some points which are outside of it.
+    void getRegion( Sample &oSample,
+                    const Abc::Box3d &iRegion,
+                    const Abc::ISampleSelector &iSS =
+                    Abc::ISampleSelector() ) const
+    {
+        PointRanges ranges;
+        getBrickRanges( iRegion, ranges, iSS );
+        getRanges( oSample, ranges, iSS );
+    }
+
+    //! Same as above, for the frustum of iToClip.
+    void getRegion( Sample &oSample,
+                    const Abc::M44d &iToClip,
+                    const Abc::ISampleSelector &iSS =
+                    Abc::ISampleSelector() ) const
+    {
+        PointRanges ranges;
+        getBrickRanges( iToClip, ranges, iSS );
+        getRanges( oSample, ranges, iSS );
+    }
+
+    //! When the points of a sample were sorted into bricks, ArbGeomParams
+    //! and user properties are still in the order the points were given
+    //! to OPointsSchema::set.  Point i of the sample was point (*oOrder)[i]
+    //! of that order, so its value of a per point arbGeomParam is
+    //! vals[(*oOrder)[i]].  oOrder is empty when the points weren't sorted.
+    void getSortOrder( Abc::UInt64ArraySamplePtr &oOrder,
+                       const Abc::ISampleSelector &iSS =
+                       Abc::ISampleSelector() ) const;
+
+    //! Same as above, for only the points in iRanges, in the same order as
+    //! getRanges reads them.
+    void getSortOrder( Abc::UInt64ArraySamplePtr &oOrder,
+                       const PointRanges &iRanges,
+                       const Abc::ISampleSelector &iSS =
+                       Abc::ISampleSelector() ) const;
+
     Abc::IP3fArrayProperty getPositionsProperty() const
     {
         return m_positionsProperty;
@@ -232,6 +309,9 @@ public:
         m_velocitiesProperty.reset();
         m_idsProperty.reset();
         m_widthsParam.reset();
+        m_brickBoundsProperty.reset();
+        m_brickStartsProperty.reset();
+        m_brickOrderProperty.reset();
 
         IGeomBaseSchema<PointsSchemaInfo>::reset();
     }
@@ -257,6 +337,16 @@ protected:
     Abc::IUInt64ArrayProperty m_idsProperty;
     Abc::IV3fArrayProperty m_velocitiesProperty;
     IFloatGeomParam m_widthsParam;
+
+    Abc::IBox3fArrayProperty m_brickBoundsProperty;
+    Abc::IUInt64ArrayProperty m_brickStartsProperty;
+    Abc::IUInt64ArrayProperty m_brickOrderProperty;
+
+private:
+    template <class INTERSECTS>
+    void getBrickRanges( const INTERSECTS &iIntersects,
+                         PointRanges &oRanges,
+                         const Abc::ISampleSelector &iSS ) const;
 };
 
 //-*****************************************************************************
@@ -124,6 +124,20 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     m_uvsParam          = rhs.m_uvsParam;
     m_normalsParam      = rhs.m_normalsParam;
 
+    // share whatever topology rhs has already read
+    Abc::Int32ArraySamplePtr indices, counts;
+    {
+        Alembic::Util::scoped_lock l( rhs.m_topologyMutex );
+        indices = rhs.m_topologyIndices;
+        counts = rhs.m_topologyCounts;
+    }
+
+    {
+        Alembic::Util::scoped_lock l( m_topologyMutex );
+        m_topologyIndices = indices;
+        m_topologyCounts = counts;
+    }
+
     // lock, reset
     Alembic::Util::scoped_lock l(m_faceSetsMutex);
     m_faceSetsLoaded = false;
@@ -132,6 +146,69 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     return *this;
 }
 
+//-*****************************************************************************
+void IPolyMeshSchema::getTopology( Sample &oSample,
+                                   const Abc::ISampleSelector &iSS ) const
+{
+    if ( !m_indicesProperty.isConstant() || !m_countsProperty.isConstant() )
+    {
+        m_indicesProperty.get( oSample.m_indices, iSS );
+        m_countsProperty.get( oSample.m_counts, iSS );
+        return;
+    }
+
+    // constant, so whatever iSS is it would get the same samples
+    Alembic::Util::scoped_lock l( m_topologyMutex );
+
+    if ( !m_topologyIndices || !m_topologyCounts )
+    {
+        m_indicesProperty.get( m_topologyIndices, iSS );
+        m_countsProperty.get( m_topologyCounts, iSS );
+    }
+
+    oSample.m_indices = m_topologyIndices;
+    oSample.m_counts = m_topologyCounts;
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getVarying( Sample &oSample,
+                                  const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getVarying()" );
+
+    m_positionsProperty.get( oSample.m_positions, iSS );
+
+    m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        m_velocitiesProperty.get( oSample.m_velocities, iSS );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getVarying( Sample &oSample,
+                                  IN3fGeomParam::Sample &oNormals,
+                                  const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getVarying()" );
+
+    getVarying( oSample, iSS );
+
+    if ( m_normalsParam )
+    {
+        m_normalsParam.getIndexed( oNormals, iSS );
+    }
+    else
+    {
+        oNormals.reset();
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IPolyMeshSchema::loadFaceSetNames()
 {
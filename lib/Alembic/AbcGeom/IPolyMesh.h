@@ -196,22 +196,30 @@ public:
     {
         ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::get()" );
 
-        m_positionsProperty.get( oSample.m_positions, iSS );
-        m_indicesProperty.get( oSample.m_indices, iSS );
-        m_countsProperty.get( oSample.m_counts, iSS );
-
-        m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
-
-        if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
-        {
-            m_velocitiesProperty.get( oSample.m_velocities, iSS );
-        }
+        getTopology( oSample, iSS );
+        getVarying( oSample, iSS );
 
         // Could error check here.
 
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Fills in only the positions, velocities and self bounds of oSample,
+    //! leaving the face indices and counts alone.  For a mesh with
+    //! kHomogenousTopology, a sample filled in by get once can be kept
+    //! up to date from frame to frame this way without touching the
+    //! topology at all.
+    void getVarying( Sample &oSample,
+                     const Abc::ISampleSelector &iSS =
+                     Abc::ISampleSelector() ) const;
+
+    //! Same as above, and also fills in oNormals with the indexed normals
+    //! if this mesh has any.
+    void getVarying( Sample &oSample,
+                     IN3fGeomParam::Sample &oNormals,
+                     const Abc::ISampleSelector &iSS =
+                     Abc::ISampleSelector() ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -267,6 +275,12 @@ public:
         m_uvsParam.reset();
         m_normalsParam.reset();
 
+        {
+            Alembic::Util::scoped_lock l( m_topologyMutex );
+            m_topologyIndices.reset();
+            m_topologyCounts.reset();
+        }
+
         IGeomBaseSchema<PolyMeshSchemaInfo>::reset();
     }
 
@@ -308,6 +322,14 @@ protected:
     std::map <std::string, IFaceSet>  m_faceSets;
     Alembic::Util::mutex                      m_faceSetsMutex;
     void loadFaceSetNames();
+
+    // When the face indices and counts are constant they are only read
+    // once, by the first get, and then shared by every sample after that.
+    mutable Abc::Int32ArraySamplePtr m_topologyIndices;
+    mutable Abc::Int32ArraySamplePtr m_topologyCounts;
+    mutable Alembic::Util::mutex m_topologyMutex;
+    void getTopology( Sample &oSample,
+                      const Abc::ISampleSelector &iSS ) const;
 };
 
 //-*****************************************************************************
@@ -37,6 +37,8 @@
 #include <Alembic/AbcGeom/IXform.h>
 #include <Alembic/AbcGeom/XformOp.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
@@ -132,6 +134,12 @@ void IXformSchema::init( const Abc::Argument &iArg0,
         {
             XformOp op( opVec[i] );
             m_sample.addOp( op );
+
+            m_opTypes.push_back( op.getType() );
+            for ( std::size_t j = 0; j < op.getNumChannels(); ++j )
+            {
+                m_defaultChannels.push_back( op.getChannelValue( j ) );
+            }
         }
 
         std::set < Alembic::Util::uint32_t >::iterator it, itEnd;
@@ -293,7 +301,7 @@ void IXformSchema::get( XformSample &oSamp, const Abc::ISampleSelector &iSS ) co
 
     if ( numSamples == 0 ) { return; }
 
-    AbcA::index_t sampIdx = iSS.getIndex( m_valsProperty->getTimeSampling(),
+    AbcA::index_t sampIdx = iSS.getIndex( *m_valsProperty,
                                           numSamples );
 
     if ( sampIdx < 0 ) { return; }
@@ -311,6 +319,95 @@ XformSample IXformSchema::getValue( const Abc::ISampleSelector &iSS ) const
     return ret;
 }
 
+//-*****************************************************************************
+bool IXformSchema::getMatrix( Abc::M44d &oMatrix,
+                              Alembic::Util::float64_t *oChannels,
+                              const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IXformSchema::getMatrix()" );
+
+    oMatrix.makeIdentity();
+
+    if ( ! valid() ) { return true; }
+
+    bool inherits = true;
+    if ( m_inheritsProperty && m_inheritsProperty.getNumSamples() > 0 )
+    {
+        inherits = m_inheritsProperty.getValue( iSS );
+    }
+
+    if ( m_opTypes.empty() ) { return inherits; }
+
+    AbcA::index_t numSamples = 0;
+    if ( m_valsProperty )
+    {
+        if ( m_useArrayProp )
+        {
+            numSamples = m_valsProperty->asArrayPtr()->getNumSamples();
+        }
+        else
+        {
+            numSamples = m_valsProperty->asScalarPtr()->getNumSamples();
+        }
+    }
+
+    AbcA::index_t sampIdx = -1;
+    if ( numSamples > 0 )
+    {
+        sampIdx = iSS.getIndex( *m_valsProperty,
+                                numSamples );
+    }
+
+    const Alembic::Util::float64_t *channels = &m_defaultChannels.front();
+
+    if ( sampIdx >= 0 && m_useArrayProp )
+    {
+        AbcA::ArraySamplePtr sptr;
+        m_valsProperty->asArrayPtr()->getSample( sampIdx, sptr );
+
+        std::size_t numChannels = std::min( sptr->size(),
+                                            m_defaultChannels.size() );
+        const Alembic::Util::float64_t *data =
+            static_cast<const Alembic::Util::float64_t*>( sptr->getData() );
+        std::copy( data, data + numChannels, oChannels );
+        std::copy( m_defaultChannels.begin() + numChannels,
+                   m_defaultChannels.end(), oChannels + numChannels );
+        channels = oChannels;
+    }
+    else if ( sampIdx >= 0 )
+    {
+        m_valsProperty->asScalarPtr()->getSample( sampIdx, oChannels );
+        channels = oChannels;
+    }
+
+    oMatrix = ComposeXformOps( &m_opTypes.front(), m_opTypes.size(),
+                               channels );
+
+    return inherits;
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return true;
+}
+
+//-*****************************************************************************
+bool IXformSchema::getMatrix( Abc::M44d &oMatrix,
+                              std::vector<Alembic::Util::float64_t> &ioChannels,
+                              const Abc::ISampleSelector &iSS ) const
+{
+    if ( ioChannels.size() < m_defaultChannels.size() )
+    {
+        ioChannels.resize( m_defaultChannels.size() );
+    }
+
+    if ( ioChannels.empty() )
+    {
+        return getMatrix( oMatrix, ( Alembic::Util::float64_t * ) NULL, iSS );
+    }
+
+    return getMatrix( oMatrix, &ioChannels.front(), iSS );
+}
+
 //-*****************************************************************************
 bool IXformSchema::getInheritsXforms( const Abc::ISampleSelector &iSS )
 {
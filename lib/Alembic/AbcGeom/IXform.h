@@ -148,12 +148,36 @@ public:
 
     size_t getNumOps() const { return m_sample.getNumOps(); }
 
+    //! The sum of the number of channels of all the ops, which is how many
+    //! values the getMatrix buffer needs room for.
+    size_t getNumOpChannels() const { return m_defaultChannels.size(); }
+
+    //! Fast path for when only the composed matrix is wanted.  The channel
+    //! values at iSS are read straight into oChannels, which must have room
+    //! for getNumOpChannels() values, and composed with the op types that
+    //! were gathered once when this schema was created, no XformSample is
+    //! built along the way.
+    //! Returns whether this xform inherits the transforms of its parents.
+    bool getMatrix( Abc::M44d &oMatrix,
+                    Alembic::Util::float64_t *oChannels,
+                    const Abc::ISampleSelector &iSS =
+                    Abc::ISampleSelector() ) const;
+
+    //! Same as above, ioChannels is only resized when it is too small so
+    //! that it can be reused from call to call without allocating.
+    bool getMatrix( Abc::M44d &oMatrix,
+                    std::vector<Alembic::Util::float64_t> &ioChannels,
+                    const Abc::ISampleSelector &iSS =
+                    Abc::ISampleSelector() ) const;
+
     //! Reset returns this function set to an empty, default
     //! state.
     void reset()
     {
         m_childBoundsProperty.reset();
         m_sample = XformSample();
+        m_opTypes.clear();
+        m_defaultChannels.clear();
         m_inheritsProperty.reset();
         m_isConstant = true;
         m_isConstantIdentity = true;
@@ -195,6 +219,11 @@ protected:
 
     XformSample m_sample;
 
+    // what getMatrix composes, the op types of m_sample and all of their
+    // channel values one op after another, used when there are no .vals
+    std::vector<XformOperationType> m_opTypes;
+    std::vector<Alembic::Util::float64_t> m_defaultChannels;
+
 private:
     void init( const Abc::Argument &iArg0, const Abc::Argument &iArg1 );
 
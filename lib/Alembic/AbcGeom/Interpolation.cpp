@@ -0,0 +1,512 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/Interpolation.h>
+#include <Alembic/Util/Threads.h>
+
+#include <ImathQuat.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+double GetInterpolationSamples( const AbcA::TimeSamplingPtr &iTimeSampling,
+                                size_t iNumSamples,
+                                chrono_t iTime,
+                                index_t &oFloor,
+                                index_t &oCeil )
+{
+    oFloor = 0;
+    oCeil = 0;
+
+    if ( !iTimeSampling || iNumSamples < 2 )
+    {
+        return 0.0;
+    }
+
+    std::pair<index_t, chrono_t> floorPair =
+        iTimeSampling->getFloorIndex( iTime, iNumSamples );
+    std::pair<index_t, chrono_t> ceilPair =
+        iTimeSampling->getCeilIndex( iTime, iNumSamples );
+
+    oFloor = floorPair.first;
+    oCeil = ceilPair.first;
+
+    if ( oCeil <= oFloor || ceilPair.second <= floorPair.second )
+    {
+        oCeil = oFloor;
+        return 0.0;
+    }
+
+    double alpha = ( iTime - floorPair.second ) /
+        ( ceilPair.second - floorPair.second );
+
+    if ( alpha <= 0.0 )
+    {
+        oCeil = oFloor;
+        return 0.0;
+    }
+    else if ( alpha >= 1.0 )
+    {
+        oFloor = oCeil;
+        return 0.0;
+    }
+
+    return alpha;
+}
+
+//-*****************************************************************************
+void LerpFloats( const Alembic::Util::float32_t *iA,
+                 const Alembic::Util::float32_t *iB,
+                 size_t iNum,
+                 Alembic::Util::float32_t iAlpha,
+                 Alembic::Util::float32_t *oVals )
+{
+    // kept as a plain loop over floats with no branches, so that the
+    // compiler can vectorize it
+    for ( size_t i = 0; i < iNum; ++i )
+    {
+        oVals[i] = iA[i] + ( iB[i] - iA[i] ) * iAlpha;
+    }
+}
+
+namespace {
+
+// below this many positions per thread it isn't worth starting one
+static const size_t kMIN_POSITIONS_PER_THREAD = 1 << 18;
+
+//-*****************************************************************************
+struct Extrapolation
+{
+    const float * positions;
+    const float * velocities;
+    float deltaTime;
+    float * result;
+};
+
+//-*****************************************************************************
+// V3f is three packed floats, so this is done over floats as one branch free
+// loop which the compiler can vectorize.
+void extrapolate( size_t iRange, size_t iBegin, size_t iEnd,
+                  void * iExtrapolation )
+{
+    const Extrapolation & e =
+        *static_cast< const Extrapolation * >( iExtrapolation );
+    const float * p = e.positions + 3 * iBegin;
+    const float * v = e.velocities + 3 * iBegin;
+    float * o = e.result + 3 * iBegin;
+    float dt = e.deltaTime;
+    size_t numFloats = 3 * ( iEnd - iBegin );
+    for ( size_t i = 0; i < numFloats; ++i )
+    {
+        o[i] = p[i] + v[i] * dt;
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void ExtrapolatePositions( const Abc::V3f *iPositions,
+                           const Abc::V3f *iVelocities,
+                           size_t iNumPositions,
+                           Alembic::Util::float32_t iDeltaTime,
+                           Abc::V3f *oPositions,
+                           size_t iNumThreads )
+{
+    if ( iNumPositions == 0 )
+    {
+        return;
+    }
+
+    Extrapolation e;
+    e.positions = &( iPositions[0].x );
+    e.velocities = &( iVelocities[0].x );
+    e.deltaTime = iDeltaTime;
+    e.result = &( oPositions[0].x );
+
+    Util::ParallelRanges( iNumPositions,
+        Util::GetNumRanges( iNumPositions, iNumThreads,
+                            kMIN_POSITIONS_PER_THREAD ),
+        extrapolate, &e );
+}
+
+//-*****************************************************************************
+// Imath::extractQuat, for the rotation in the upper 3x3 of iMat
+static Abc::Quatd rotationToQuat( const Abc::M44d &iMat )
+{
+    Abc::Quatd q;
+    double trace = iMat[0][0] + iMat[1][1] + iMat[2][2];
+
+    if ( trace > 0.0 )
+    {
+        double s = sqrt( trace + 1.0 );
+        q.r = s / 2.0;
+        s = 0.5 / s;
+        q.v.x = ( iMat[1][2] - iMat[2][1] ) * s;
+        q.v.y = ( iMat[2][0] - iMat[0][2] ) * s;
+        q.v.z = ( iMat[0][1] - iMat[1][0] ) * s;
+    }
+    else
+    {
+        int nxt[3] = { 1, 2, 0 };
+        int i = 0;
+        if ( iMat[1][1] > iMat[0][0] ) { i = 1; }
+        if ( iMat[2][2] > iMat[i][i] ) { i = 2; }
+        int j = nxt[i];
+        int k = nxt[j];
+
+        double s = sqrt( ( iMat[i][i] - ( iMat[j][j] + iMat[k][k] ) ) + 1.0 );
+        double qv[3];
+        qv[i] = s * 0.5;
+        if ( s != 0.0 ) { s = 0.5 / s; }
+
+        q.r = ( iMat[j][k] - iMat[k][j] ) * s;
+        qv[j] = ( iMat[i][j] + iMat[j][i] ) * s;
+        qv[k] = ( iMat[i][k] + iMat[k][i] ) * s;
+        q.v = Abc::V3d( qv[0], qv[1], qv[2] );
+    }
+
+    return q.normalized();
+}
+
+//-*****************************************************************************
+// Splits an affine matrix into M = S * H * R * T, the same way as
+// Imath::extractSHRT, returns false if it can't be split.
+static bool splitMatrix( const Abc::M44d &iMat, Abc::V3d &oScale,
+                         Abc::V3d &oShear, Abc::Quatd &oRot,
+                         Abc::V3d &oTrans )
+{
+    if ( iMat[0][3] != 0.0 || iMat[1][3] != 0.0 || iMat[2][3] != 0.0 ||
+         iMat[3][3] != 1.0 )
+    {
+        return false;
+    }
+
+    Abc::V3d row[3];
+    for ( int i = 0; i < 3; ++i )
+    {
+        row[i] = Abc::V3d( iMat[i][0], iMat[i][1], iMat[i][2] );
+    }
+
+    oScale.x = row[0].length();
+    if ( oScale.x == 0.0 ) { return false; }
+    row[0] /= oScale.x;
+
+    oShear.x = row[0].dot( row[1] );
+    row[1] -= row[0] * oShear.x;
+
+    oScale.y = row[1].length();
+    if ( oScale.y == 0.0 ) { return false; }
+    row[1] /= oScale.y;
+    oShear.x /= oScale.y;
+
+    oShear.y = row[0].dot( row[2] );
+    row[2] -= row[0] * oShear.y;
+    oShear.z = row[1].dot( row[2] );
+    row[2] -= row[1] * oShear.z;
+
+    oScale.z = row[2].length();
+    if ( oScale.z == 0.0 ) { return false; }
+    row[2] /= oScale.z;
+    oShear.y /= oScale.z;
+    oShear.z /= oScale.z;
+
+    if ( row[0].dot( row[1].cross( row[2] ) ) < 0.0 )
+    {
+        oScale *= -1.0;
+        for ( int i = 0; i < 3; ++i ) { row[i] *= -1.0; }
+    }
+
+    Abc::M44d rot;
+    for ( int i = 0; i < 3; ++i )
+    {
+        rot[i][0] = row[i].x;
+        rot[i][1] = row[i].y;
+        rot[i][2] = row[i].z;
+    }
+    oRot = rotationToQuat( rot );
+
+    oTrans = Abc::V3d( iMat[3][0], iMat[3][1], iMat[3][2] );
+
+    return true;
+}
+
+//-*****************************************************************************
+static Abc::M44d interpolateMatrix( const Abc::M44d &iA, const Abc::M44d &iB,
+                                    double iAlpha )
+{
+    Abc::V3d sA, hA, tA, sB, hB, tB;
+    Abc::Quatd rA, rB;
+
+    if ( !splitMatrix( iA, sA, hA, rA, tA ) ||
+         !splitMatrix( iB, sB, hB, rB, tB ) )
+    {
+        // not something we can take apart, so just blend the values
+        Abc::M44d ret;
+        for ( int i = 0; i < 4; ++i )
+        {
+            for ( int j = 0; j < 4; ++j )
+            {
+                ret[i][j] = iA[i][j] + ( iB[i][j] - iA[i][j] ) * iAlpha;
+            }
+        }
+        return ret;
+    }
+
+    Abc::V3d s = sA + ( sB - sA ) * iAlpha;
+    Abc::V3d h = hA + ( hB - hA ) * iAlpha;
+    Abc::V3d t = tA + ( tB - tA ) * iAlpha;
+    Abc::M44d r = Imath::slerpShortestArc( rA, rB, iAlpha ).toMatrix44();
+
+    Abc::V3d rRow[3];
+    for ( int i = 0; i < 3; ++i )
+    {
+        rRow[i] = Abc::V3d( r[i][0], r[i][1], r[i][2] );
+    }
+
+    Abc::V3d row[3];
+    row[0] = rRow[0] * s.x;
+    row[1] = ( rRow[0] * h.x + rRow[1] ) * s.y;
+    row[2] = ( rRow[0] * h.y + rRow[1] * h.z + rRow[2] ) * s.z;
+
+    Abc::M44d ret;
+    for ( int i = 0; i < 3; ++i )
+    {
+        ret[i][0] = row[i].x;
+        ret[i][1] = row[i].y;
+        ret[i][2] = row[i].z;
+        ret[i][3] = 0.0;
+    }
+    ret[3][0] = t.x;
+    ret[3][1] = t.y;
+    ret[3][2] = t.z;
+    ret[3][3] = 1.0;
+
+    return ret;
+}
+
+//-*****************************************************************************
+bool InterpolateXformSamples( const XformSample &iFloor,
+                              const XformSample &iCeil,
+                              double iAlpha,
+                              XformSample &oSample )
+{
+    std::size_t numOps = iFloor.getNumOps();
+    if ( numOps != iCeil.getNumOps() )
+    {
+        return false;
+    }
+
+    for ( std::size_t i = 0; i < numOps; ++i )
+    {
+        if ( iFloor[i].getType() != iCeil[i].getType() )
+        {
+            return false;
+        }
+    }
+
+    oSample = iFloor;
+
+    for ( std::size_t i = 0; i < numOps; ++i )
+    {
+        const XformOp &a = iFloor[i];
+        const XformOp &b = iCeil[i];
+        XformOp &op = oSample[i];
+
+        if ( a.getType() == kMatrixOperation )
+        {
+            op.setMatrix( interpolateMatrix( a.getMatrix(), b.getMatrix(),
+                                             iAlpha ) );
+        }
+        else if ( a.getType() == kRotateOperation &&
+                  a.getAxis() != b.getAxis() )
+        {
+            Abc::Quatd qA;
+            qA.setAxisAngle( a.getAxis(), DegreesToRadians( a.getAngle() ) );
+            Abc::Quatd qB;
+            qB.setAxisAngle( b.getAxis(), DegreesToRadians( b.getAngle() ) );
+            Abc::Quatd q = Imath::slerpShortestArc( qA, qB, iAlpha );
+
+            // pick an axis when there's no rotation to take one from
+            Abc::V3d axis = q.v.length() > 0.0 ? q.axis() : a.getAxis();
+            op.setAxis( axis );
+            op.setAngle( RadiansToDegrees( q.angle() ) );
+        }
+        else
+        {
+            // translate, scale, and rotations around a fixed axis
+            for ( std::size_t j = 0; j < a.getNumChannels(); ++j )
+            {
+                double va = a.getChannelValue( j );
+                double vb = b.getChannelValue( j );
+                op.setChannelValue( j, va + ( vb - va ) * iAlpha );
+            }
+        }
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+IXformInterpolator::IXformInterpolator()
+  : m_floorIndex( -1 )
+  , m_ceilIndex( -1 )
+{
+}
+
+//-*****************************************************************************
+IXformInterpolator::IXformInterpolator( const IXformSchema &iSchema )
+  : m_schema( iSchema )
+  , m_floorIndex( -1 )
+  , m_ceilIndex( -1 )
+{
+}
+
+//-*****************************************************************************
+const XformSample &IXformInterpolator::get( chrono_t iTime )
+{
+    index_t floorIndex = 0;
+    index_t ceilIndex = 0;
+    double alpha = GetInterpolationSamples( m_schema.getTimeSampling(),
+                                            m_schema.getNumSamples(),
+                                            iTime, floorIndex, ceilIndex );
+
+    if ( floorIndex != m_floorIndex )
+    {
+        if ( floorIndex == m_ceilIndex )
+        {
+            // stepping forward, what was the ceil is now the floor
+            std::swap( m_floor, m_ceil );
+            std::swap( m_floorIndex, m_ceilIndex );
+        }
+        else
+        {
+            m_schema.get( m_floor, Abc::ISampleSelector( floorIndex ) );
+            m_floorIndex = floorIndex;
+        }
+    }
+
+    if ( alpha == 0.0 )
+    {
+        return m_floor;
+    }
+
+    if ( ceilIndex != m_ceilIndex )
+    {
+        m_schema.get( m_ceil, Abc::ISampleSelector( ceilIndex ) );
+        m_ceilIndex = ceilIndex;
+    }
+
+    if ( !InterpolateXformSamples( m_floor, m_ceil, alpha, m_sample ) )
+    {
+        return m_floor;
+    }
+
+    return m_sample;
+}
+
+//-*****************************************************************************
+IVelocityExtrapolator::IVelocityExtrapolator()
+  : m_index( -1 )
+  , m_sampleTime( 0.0 )
+{
+}
+
+//-*****************************************************************************
+IVelocityExtrapolator::IVelocityExtrapolator(
+    const Abc::IP3fArrayProperty &iPositions,
+    const Abc::IV3fArrayProperty &iVelocities )
+  : m_positionsProperty( iPositions )
+  , m_velocitiesProperty( iVelocities )
+  , m_index( -1 )
+  , m_sampleTime( 0.0 )
+{
+}
+
+//-*****************************************************************************
+Abc::P3fArraySample
+IVelocityExtrapolator::get( const Abc::ISampleSelector &iSS, chrono_t iTime )
+{
+    if ( !m_positionsProperty || m_positionsProperty.getNumSamples() == 0 )
+    {
+        return Abc::P3fArraySample();
+    }
+
+    AbcA::TimeSamplingPtr ts = m_positionsProperty.getTimeSampling();
+    index_t index = iSS.getIndex( ts, m_positionsProperty.getNumSamples() );
+
+    if ( index != m_index )
+    {
+        m_index = index;
+        m_sampleTime = ts->getSampleTime( index );
+        m_positionsProperty.get( m_positions, Abc::ISampleSelector( index ) );
+
+        // the velocities at the time of the positions, which is the same
+        // index when they are written alongside each other, and the only
+        // sample when the velocities are constant
+        m_velocities.reset();
+        if ( m_velocitiesProperty &&
+             m_velocitiesProperty.getNumSamples() > 0 )
+        {
+            m_velocitiesProperty.get( m_velocities, Abc::ISampleSelector(
+                m_sampleTime, Abc::ISampleSelector::kNearIndex ) );
+        }
+    }
+
+    float deltaTime = static_cast<float>( iTime - m_sampleTime );
+    size_t numPositions = m_positions->size();
+
+    if ( deltaTime == 0.0f || numPositions == 0 || !m_velocities ||
+         m_velocities->size() != numPositions )
+    {
+        return Abc::P3fArraySample( m_positions->get(),
+                                    m_positions->getDimensions() );
+    }
+
+    m_buffer.resize( numPositions );
+    ExtrapolatePositions( m_positions->get(), m_velocities->get(),
+                          numPositions, deltaTime, &m_buffer.front() );
+
+    return Abc::P3fArraySample( &m_buffer.front(),
+                                m_positions->getDimensions() );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,302 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_Interpolation_h_
+#define _Alembic_AbcGeom_Interpolation_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/IXform.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Finds the two samples on either side of iTime, and returns how far iTime
+//! is from oFloor towards oCeil, between 0 and 1.  When iTime lands on a
+//! sample, or is outside of the sampled range, oFloor and oCeil are the
+//! same sample and 0 is returned.
+ALEMBIC_EXPORT double
+GetInterpolationSamples( const AbcA::TimeSamplingPtr &iTimeSampling,
+                         size_t iNumSamples,
+                         chrono_t iTime,
+                         index_t &oFloor,
+                         index_t &oCeil );
+
+//! oVals[i] = iA[i] + ( iB[i] - iA[i] ) * iAlpha for each of the iNum values.
+//! oVals may be the same as iA or iB.
+ALEMBIC_EXPORT void LerpFloats( const Alembic::Util::float32_t *iA,
+                                const Alembic::Util::float32_t *iB,
+                                size_t iNum,
+                                Alembic::Util::float32_t iAlpha,
+                                Alembic::Util::float32_t *oVals );
+
+//! Interpolates each op of two samples which have the same ops.
+//! Translates, scales and single axis rotations are interpolated linearly,
+//! rotations around other axes are slerped, and matrices are split into
+//! scale, shear, rotation and translation which are interpolated the same
+//! way.  Returns false, leaving oSample alone, if the ops don't match.
+ALEMBIC_EXPORT bool InterpolateXformSamples( const XformSample &iFloor,
+                                             const XformSample &iCeil,
+                                             double iAlpha,
+                                             XformSample &oSample );
+
+//! oPositions[i] = iPositions[i] + iVelocities[i] * iDeltaTime, for each of
+//! the iNumPositions positions.  oPositions may be the same as iPositions.
+//! Like ComputeBoundsFromPositions, big arrays are split across threads,
+//! iNumThreads of them, or when it is 0 as many as are worth it.
+ALEMBIC_EXPORT void ExtrapolatePositions( const Abc::V3f *iPositions,
+                                          const Abc::V3f *iVelocities,
+                                          size_t iNumPositions,
+                                          Alembic::Util::float32_t iDeltaTime,
+                                          Abc::V3f *oPositions,
+                                          size_t iNumThreads = 0 );
+
+//-*****************************************************************************
+//! Interpolates an array property of float based values, such as the
+//! positions of an IPolyMesh, IPoints or ICurves (getPositionsProperty), or
+//! their velocities, between the samples either side of a time.
+//!
+//! The interpolated values go in a buffer which is reused from call to call,
+//! and the two samples which were last read are held on to, so stepping
+//! forward through time only reads one new sample per step.
+//!
+//! The values are interpolated as float32_t, so TRAITS has to be made up of
+//! them, and constructing one for any other POD throws.
+template <class TRAITS>
+class ITypedArrayInterpolator
+{
+public:
+    typedef typename TRAITS::value_type value_type;
+    typedef Abc::ITypedArrayProperty<TRAITS> property_type;
+    typedef Abc::TypedArraySample<TRAITS> sample_type;
+    typedef Alembic::Util::shared_ptr<sample_type> sample_ptr_type;
+
+    ITypedArrayInterpolator() : m_floorIndex( -1 ), m_ceilIndex( -1 )
+    { checkPod(); }
+
+    explicit ITypedArrayInterpolator( const property_type &iProperty )
+      : m_property( iProperty )
+      , m_floorIndex( -1 )
+      , m_ceilIndex( -1 )
+    { checkPod(); }
+
+    //! Returns the values at iTime, which stay valid until the next call.
+    //! When the samples either side don't have the same number of values,
+    //! because the topology changes between them, the floor sample is
+    //! returned as is.
+    sample_type get( chrono_t iTime );
+
+    const property_type &getProperty() const { return m_property; }
+
+private:
+    static void checkPod()
+    {
+        ABCA_ASSERT( TRAITS::pod_enum == Alembic::Util::kFloat32POD,
+                     "Only float32_t based values can be interpolated, not: "
+                     << TRAITS::dataType() );
+    }
+
+    sample_ptr_type getSample( index_t iIndex );
+
+    property_type m_property;
+
+    index_t m_floorIndex;
+    sample_ptr_type m_floor;
+
+    index_t m_ceilIndex;
+    sample_ptr_type m_ceil;
+
+    std::vector<value_type> m_buffer;
+};
+
+//-*****************************************************************************
+template <class TRAITS>
+typename ITypedArrayInterpolator<TRAITS>::sample_ptr_type
+ITypedArrayInterpolator<TRAITS>::getSample( index_t iIndex )
+{
+    // reuse whichever of the last two samples we already have
+    if ( iIndex == m_floorIndex ) { return m_floor; }
+    if ( iIndex == m_ceilIndex ) { return m_ceil; }
+
+    sample_ptr_type ret;
+    m_property.get( ret, Abc::ISampleSelector( iIndex ) );
+    return ret;
+}
+
+//-*****************************************************************************
+template <class TRAITS>
+typename ITypedArrayInterpolator<TRAITS>::sample_type
+ITypedArrayInterpolator<TRAITS>::get( chrono_t iTime )
+{
+    index_t floorIndex = 0;
+    index_t ceilIndex = 0;
+    double alpha = GetInterpolationSamples( m_property.getTimeSampling(),
+                                            m_property.getNumSamples(),
+                                            iTime, floorIndex, ceilIndex );
+
+    sample_ptr_type floorSamp = getSample( floorIndex );
+    sample_ptr_type ceilSamp = getSample( ceilIndex );
+
+    m_floorIndex = floorIndex;
+    m_floor = floorSamp;
+    m_ceilIndex = ceilIndex;
+    m_ceil = ceilSamp;
+
+    if ( !floorSamp || !floorSamp->valid() )
+    {
+        return sample_type();
+    }
+
+    if ( alpha == 0.0 || !ceilSamp || ceilSamp->size() != floorSamp->size() )
+    {
+        return sample_type( floorSamp->get(), floorSamp->getDimensions() );
+    }
+
+    size_t numVals = floorSamp->size();
+    m_buffer.resize( numVals );
+    if ( numVals == 0 )
+    {
+        return sample_type( floorSamp->get(), floorSamp->getDimensions() );
+    }
+
+    // every value is made up of float32_t
+    size_t numFloats = numVals * sizeof( value_type ) /
+        sizeof( Alembic::Util::float32_t );
+
+    LerpFloats(
+        reinterpret_cast<const Alembic::Util::float32_t *>( floorSamp->get() ),
+        reinterpret_cast<const Alembic::Util::float32_t *>( ceilSamp->get() ),
+        numFloats, static_cast<Alembic::Util::float32_t>( alpha ),
+        reinterpret_cast<Alembic::Util::float32_t *>( &m_buffer.front() ) );
+
+    return sample_type( &m_buffer.front(), floorSamp->getDimensions() );
+}
+
+typedef ITypedArrayInterpolator<Abc::P3fTPTraits> IP3fArrayInterpolator;
+typedef ITypedArrayInterpolator<Abc::V3fTPTraits> IV3fArrayInterpolator;
+typedef ITypedArrayInterpolator<Abc::N3fTPTraits> IN3fArrayInterpolator;
+typedef ITypedArrayInterpolator<Abc::Float32TPTraits> IFloatArrayInterpolator;
+
+//-*****************************************************************************
+//! Interpolates an xform between the samples either side of a time, see
+//! InterpolateXformSamples.  Like ITypedArrayInterpolator the last two
+//! samples read are held on to, and the result goes into a sample which is
+//! reused from call to call.
+class ALEMBIC_EXPORT IXformInterpolator
+{
+public:
+    IXformInterpolator();
+
+    explicit IXformInterpolator( const IXformSchema &iSchema );
+
+    //! Returns the sample at iTime, which stays valid until the next call.
+    const XformSample &get( chrono_t iTime );
+
+    //! Returns the matrix at iTime.
+    Abc::M44d getMatrix( chrono_t iTime ) { return get( iTime ).getMatrix(); }
+
+    const IXformSchema &getSchema() const { return m_schema; }
+
+private:
+    void getSample( index_t iIndex, XformSample &oSample );
+
+    IXformSchema m_schema;
+
+    index_t m_floorIndex;
+    XformSample m_floor;
+
+    index_t m_ceilIndex;
+    XformSample m_ceil;
+
+    XformSample m_sample;
+};
+
+//-*****************************************************************************
+//! Works out positions at any time from a single sample, by moving them
+//! along their velocities, for schemas which have both such as IPoints and
+//! IPolyMesh.  Unlike interpolating, this works when the number of points
+//! changes from sample to sample, and only needs one sample for all the
+//! times in a shutter interval.
+//!
+//! The sample is only read again when a different one is asked for.
+class ALEMBIC_EXPORT IVelocityExtrapolator
+{
+public:
+    IVelocityExtrapolator();
+
+    //! Usually iSchema.getPositionsProperty() and
+    //! iSchema.getVelocitiesProperty(), iVelocities may be invalid.
+    IVelocityExtrapolator( const Abc::IP3fArrayProperty &iPositions,
+                           const Abc::IV3fArrayProperty &iVelocities );
+
+    //! Returns the positions of the sample picked by iSS, moved to iTime.
+    //! They stay valid until the next call.  The velocities are read at the
+    //! time of that positions sample, so constant velocities apply to every
+    //! sample.  When there are no velocities, or not as many as there are
+    //! positions, the positions are returned as is.
+    Abc::P3fArraySample get( const Abc::ISampleSelector &iSS,
+                             chrono_t iTime );
+
+    //! Same as above with the sample at or before iTime.
+    Abc::P3fArraySample get( chrono_t iTime )
+    {
+        return get( Abc::ISampleSelector( iTime,
+                                          Abc::ISampleSelector::kFloorIndex ),
+                    iTime );
+    }
+
+private:
+    Abc::IP3fArrayProperty m_positionsProperty;
+    Abc::IV3fArrayProperty m_velocitiesProperty;
+
+    index_t m_index;
+    chrono_t m_sampleTime;
+    Abc::P3fArraySamplePtr m_positions;
+    Abc::V3fArraySamplePtr m_velocities;
+
+    std::vector<Abc::V3f> m_buffer;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -37,15 +37,235 @@
 #include <Alembic/AbcGeom/OPoints.h>
 #include <Alembic/AbcGeom/GeometryScope.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// Spreads the low 21 bits of iVal out so that there are two 0 bits between
+// each of them.
+Alembic::Util::uint64_t spreadBits( Alembic::Util::uint64_t iVal )
+{
+    Alembic::Util::uint64_t x = iVal & 0x1fffff;
+    x = ( x | x << 32 ) & 0x1f00000000ffffULL;
+    x = ( x | x << 16 ) & 0x1f0000ff0000ffULL;
+    x = ( x | x << 8 ) & 0x100f00f00f00f00fULL;
+    x = ( x | x << 4 ) & 0x10c30c30c30c30c3ULL;
+    x = ( x | x << 2 ) & 0x1249249249249249ULL;
+    return x;
+}
+
+//-*****************************************************************************
+// The per point data of a sample, reordered so that the points are sorted
+// along a Morton curve through their bounds.  order is where each sorted
+// point was in the sample.
+struct SortedPoints
+{
+    std::vector<Alembic::Util::uint64_t> order;
+    std::vector<Abc::V3f> positions;
+    std::vector<Alembic::Util::uint64_t> ids;
+    std::vector<Abc::V3f> velocities;
+    std::vector<Alembic::Util::float32_t> widths;
+};
+
+//-*****************************************************************************
+void sortPoints( const OPointsSchema::Sample &iSamp, SortedPoints &oSorted )
+{
+    const Abc::P3fArraySample &positions = iSamp.getPositions();
+    size_t numPoints = positions.size();
+
+    Abc::Box3f bounds;
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        bounds.extendBy( positions[i] );
+    }
+
+    Abc::V3f scale( 0.0f );
+    if ( !bounds.isEmpty() )
+    {
+        Abc::V3f size = bounds.size();
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            if ( size[j] > 0.0f )
+            {
+                scale[j] = 2097151.0f / size[j];
+            }
+        }
+    }
+
+    std::vector< std::pair< Alembic::Util::uint64_t, size_t > > order(
+        numPoints );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        Alembic::Util::uint64_t code = 0;
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            float q = ( positions[i][j] - bounds.min[j] ) * scale[j];
+
+            // this also sends NaN to 0
+            if ( !( q > 0.0f ) ) { q = 0.0f; }
+            if ( q > 2097151.0f ) { q = 2097151.0f; }
+            code |= spreadBits( ( Alembic::Util::uint64_t ) q ) << j;
+        }
+        order[i] = std::make_pair( code, i );
+    }
+
+    std::sort( order.begin(), order.end() );
+
+    oSorted.order.resize( numPoints );
+    oSorted.positions.resize( numPoints );
+    oSorted.ids.resize( numPoints );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        oSorted.order[i] = order[i].second;
+        oSorted.positions[i] = positions[ order[i].second ];
+        oSorted.ids[i] = iSamp.getIds()[ order[i].second ];
+    }
+
+    if ( iSamp.getVelocities() )
+    {
+        oSorted.velocities.resize( numPoints );
+        for ( size_t i = 0; i < numPoints; ++i )
+        {
+            oSorted.velocities[i] = iSamp.getVelocities()[ order[i].second ];
+        }
+    }
+
+    const Abc::FloatArraySample &widths = iSamp.getWidths().getVals();
+    if ( widths.size() == numPoints )
+    {
+        oSorted.widths.resize( numPoints );
+        for ( size_t i = 0; i < numPoints; ++i )
+        {
+            oSorted.widths[i] = widths[ order[i].second ];
+        }
+    }
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 void OPointsSchema::set( const Sample &iSamp )
 {
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPointsSchema::set()" );
 
+    if ( m_brickSize > 0 && !m_brickBoundsProperty )
+    {
+        AbcA::CompoundPropertyWriterPtr _this = this->getPtr();
+        AbcA::TimeSamplingPtr ts = m_positionsProperty.getTimeSampling();
+        m_brickBoundsProperty = Abc::OBox3fArrayProperty( _this,
+            ".brickBnds", ts );
+        m_brickStartsProperty = Abc::OUInt64ArrayProperty( _this,
+            ".brickStarts", ts );
+        m_brickOrderProperty = Abc::OUInt64ArrayProperty( _this,
+            ".brickOrder", ts );
+
+        // the samples already written have no bricks, which readers take
+        // to mean they have to read everything
+        std::vector<Abc::Box3f> emptyBnds;
+        std::vector<Alembic::Util::uint64_t> emptyStarts;
+        const size_t numSamps = m_positionsProperty.getNumSamples();
+        for ( size_t i = 0 ; i < numSamps ; ++i )
+        {
+            m_brickBoundsProperty.set( Abc::Box3fArraySample( emptyBnds ) );
+            m_brickStartsProperty.set(
+                Abc::UInt64ArraySample( emptyStarts ) );
+            m_brickOrderProperty.set(
+                Abc::UInt64ArraySample( emptyStarts ) );
+        }
+    }
+
+    if ( !m_brickBoundsProperty )
+    {
+        setSample( iSamp );
+        return;
+    }
+
+    if ( !iSamp.getPositions() )
+    {
+        setSample( iSamp );
+        m_brickBoundsProperty.setFromPrevious();
+        m_brickStartsProperty.setFromPrevious();
+        m_brickOrderProperty.setFromPrevious();
+        return;
+    }
+
+    size_t numPoints = iSamp.getPositions().size();
+
+    // everything that gets written per point has to be here to be sorted,
+    // arbGeomParams and user properties are written by the caller in the
+    // order it gave us, readers put those in the sorted order with
+    // .brickOrder
+    bool canSort = m_brickSize > 0 && iSamp.getIds().size() == numPoints;
+    if ( iSamp.getVelocities() || m_velocitiesProperty )
+    {
+        canSort = canSort && iSamp.getVelocities().size() == numPoints;
+    }
+    if ( iSamp.getWidths() || m_widthsParam )
+    {
+        size_t numWidths = iSamp.getWidths().getVals().size();
+        canSort = canSort && !iSamp.getWidths().getIndices() &&
+            ( numWidths == numPoints || numWidths == 1 );
+    }
+
+    SortedPoints sorted;
+    Sample samp = iSamp;
+    size_t brickSize = numPoints;
+    if ( canSort )
+    {
+        sortPoints( iSamp, sorted );
+        brickSize = m_brickSize;
+
+        samp.setPositions( Abc::P3fArraySample( sorted.positions ) );
+        samp.setIds( Abc::UInt64ArraySample( sorted.ids ) );
+        if ( !sorted.velocities.empty() )
+        {
+            samp.setVelocities( Abc::V3fArraySample( sorted.velocities ) );
+        }
+        if ( !sorted.widths.empty() )
+        {
+            samp.setWidths( OFloatGeomParam::Sample(
+                Abc::FloatArraySample( sorted.widths ),
+                iSamp.getWidths().getScope() ) );
+        }
+    }
+
+    setSample( samp );
+
+    const Abc::P3fArraySample &positions = samp.getPositions();
+    std::vector<Abc::Box3f> bricks;
+    std::vector<Alembic::Util::uint64_t> starts;
+    for ( size_t i = 0; i < numPoints; i += brickSize )
+    {
+        size_t end = std::min( i + brickSize, numPoints );
+        Abc::Box3f bnds;
+        for ( size_t j = i; j < end; ++j )
+        {
+            bnds.extendBy( positions[j] );
+        }
+        bricks.push_back( bnds );
+        starts.push_back( i );
+    }
+
+    m_brickBoundsProperty.set( Abc::Box3fArraySample( bricks ) );
+    m_brickStartsProperty.set( Abc::UInt64ArraySample( starts ) );
+
+    // samples which weren't sorted get no order, they are as they were given
+    m_brickOrderProperty.set( Abc::UInt64ArraySample( sorted.order ) );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void OPointsSchema::setSample( const Sample &iSamp )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPointsSchema::set()" );
+
     // do we need to create velocities prop?
     if ( iSamp.getVelocities() && !m_velocitiesProperty )
     {
@@ -168,6 +388,13 @@ void OPointsSchema::setFromPrevious()
         m_widthsParam.setFromPrevious();
     }
 
+    if ( m_brickBoundsProperty )
+    {
+        m_brickBoundsProperty.setFromPrevious();
+        m_brickStartsProperty.setFromPrevious();
+        m_brickOrderProperty.setFromPrevious();
+    }
+
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
@@ -186,6 +413,13 @@ void OPointsSchema::setTimeSampling( uint32_t iIndex )
         m_widthsParam.setTimeSampling( iIndex );
     }
 
+    if ( m_brickBoundsProperty )
+    {
+        m_brickBoundsProperty.setTimeSampling( iIndex );
+        m_brickStartsProperty.setTimeSampling( iIndex );
+        m_brickOrderProperty.setTimeSampling( iIndex );
+    }
+
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
@@ -218,6 +452,8 @@ void OPointsSchema::init( uint32_t iTsIdx )
     m_idsProperty = Abc::OUInt64ArrayProperty( _this, ".pointIds", mdata,
                                                iTsIdx );
 
+    m_brickSize = 0;
+
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
@@ -143,7 +143,7 @@ public:
 
     //! The default constructor creates an empty OPointsSchema
     //! ...
-    OPointsSchema() {}
+    OPointsSchema() : m_brickSize( 0 ) {}
 
     //! This templated, primary constructor creates a new poly mesh writer.
     //! The first argument is any Abc (or AbcCoreAbstract) object
@@ -246,6 +246,22 @@ public:
     void setTimeSampling( uint32_t iIndex );
     void setTimeSampling( AbcA::TimeSamplingPtr iTime );
 
+    //! When iPointsPerBrick isn't 0, each sample set after this is sorted
+    //! along a Morton curve and split into bricks of that many points, and
+    //! the bounds of each brick are written alongside the sample so that
+    //! IPointsSchema::getRegion only has to read the bricks it needs.
+    //! The positions, ids, velocities and widths are all reordered the
+    //! same way, so a sample can only be sorted when all of the ones this
+    //! schema writes are in it with a value per point; other samples are
+    //! written as they are, as a single brick.
+    //! ArbGeomParams and user properties are written as they are given, in
+    //! the order of the points passed to set.  Where each sorted point was
+    //! in that order is written too, see IPointsSchema::getSortOrder.
+    void setSpatialBrickSize( size_t iPointsPerBrick )
+    { m_brickSize = iPointsPerBrick; }
+
+    size_t getSpatialBrickSize() const { return m_brickSize; }
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, validity,
@@ -260,6 +276,10 @@ public:
         m_idsProperty.reset();
         m_velocitiesProperty.reset();
         m_widthsParam.reset();
+        m_brickBoundsProperty.reset();
+        m_brickStartsProperty.reset();
+        m_brickOrderProperty.reset();
+        m_brickSize = 0;
 
         OGeomBaseSchema<PointsSchemaInfo>::reset();
     }
@@ -285,6 +305,14 @@ protected:
     Abc::OV3fArrayProperty m_velocitiesProperty;
     OFloatGeomParam m_widthsParam;
 
+    // the bounds of each brick, and the index of the first point in it
+    size_t m_brickSize;
+    Abc::OBox3fArrayProperty m_brickBoundsProperty;
+    Abc::OUInt64ArrayProperty m_brickStartsProperty;
+    Abc::OUInt64ArrayProperty m_brickOrderProperty;
+
+private:
+    void setSample( const Sample &iSamp );
 };
 
 //-*****************************************************************************
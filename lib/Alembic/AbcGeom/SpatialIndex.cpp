@@ -0,0 +1,494 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/SpatialIndex.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+static const std::string kSpatialIndexName = ".spatialIndex";
+
+// leaves are split until there are no more than this many in a node
+static const size_t kMaxLeavesPerNode = 4;
+
+//-*****************************************************************************
+Abc::Box3d transformBox( const Abc::Box3d & iBox, const Abc::M44d & iMatrix )
+{
+    Abc::Box3d ret;
+    if ( iBox.isEmpty() )
+    {
+        return ret;
+    }
+
+    for ( int c = 0; c < 8; ++c )
+    {
+        Abc::V3d p( ( c & 1 ) ? iBox.max.x : iBox.min.x,
+                    ( c & 2 ) ? iBox.max.y : iBox.min.y,
+                    ( c & 4 ) ? iBox.max.z : iBox.min.z );
+        Abc::V3d q;
+        iMatrix.multVecMatrix( p, q );
+        ret.extendBy( q );
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+// Reads the bounds property iName of the schema compound iSchemaName, returns
+// false if there isn't one.
+bool readBounds( const Abc::IObject & iObject,
+                 const std::string & iSchemaName,
+                 const std::string & iName,
+                 const Abc::ISampleSelector &iSS,
+                 Abc::Box3d & oBounds )
+{
+    Abc::ICompoundProperty props = iObject.getProperties();
+    const AbcA::PropertyHeader * schemaHeader =
+        props.getPropertyHeader( iSchemaName );
+
+    if ( !schemaHeader || !schemaHeader->isCompound() )
+    {
+        return false;
+    }
+
+    Abc::ICompoundProperty schema( props, iSchemaName );
+    const AbcA::PropertyHeader * boundsHeader =
+        schema.getPropertyHeader( iName );
+
+    if ( !boundsHeader || !Abc::IBox3dProperty::matches( *boundsHeader ) )
+    {
+        return false;
+    }
+
+    Abc::IBox3dProperty bounds( schema, iName );
+    if ( bounds.getNumSamples() == 0 )
+    {
+        return false;
+    }
+
+    oBounds = bounds.getValue( iSS );
+    return true;
+}
+
+//-*****************************************************************************
+// Orders leaf indices by the centers of their bounds along one axis.
+struct CenterLess
+{
+    CenterLess( const std::vector< Abc::Box3d > & iBounds, unsigned int iAxis )
+      : bounds( iBounds ), axis( iAxis ) {}
+
+    bool operator()( size_t a, size_t b ) const
+    {
+        return bounds[a].min[axis] + bounds[a].max[axis] <
+            bounds[b].min[axis] + bounds[b].max[axis];
+    }
+
+    const std::vector< Abc::Box3d > & bounds;
+    unsigned int axis;
+};
+
+//-*****************************************************************************
+// A node still to be built, and the part of the leaf order it covers.
+struct NodeRange
+{
+    size_t node;
+    size_t begin;
+    size_t end;
+};
+
+//-*****************************************************************************
+struct BoxIntersects
+{
+    explicit BoxIntersects( const Abc::Box3d &iRegion ) : region( iRegion ) {}
+
+    bool operator()( const Abc::Box3d &iBounds ) const
+    {
+        return region.intersects( iBounds );
+    }
+
+    Abc::Box3d region;
+};
+
+//-*****************************************************************************
+struct FrustumIntersects
+{
+    explicit FrustumIntersects( const Abc::M44d &iToClip ) : toClip( iToClip )
+    {}
+
+    bool operator()( const Abc::Box3d &iBounds ) const
+    {
+        return BoundsIntersectFrustum( iBounds, toClip );
+    }
+
+    Abc::M44d toClip;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+SpatialIndex::SpatialIndex()
+{
+}
+
+//-*****************************************************************************
+void SpatialIndex::clear()
+{
+    m_leafNames.clear();
+    m_leafBounds.clear();
+    m_nodes.clear();
+}
+
+//-*****************************************************************************
+void SpatialIndex::build( Abc::IArchive & iArchive,
+                          const Abc::ISampleSelector &iSS )
+{
+    WorldXformCache xforms( iArchive );
+    xforms.evaluate( iSS );
+    build( xforms, iSS );
+}
+
+//-*****************************************************************************
+void SpatialIndex::build( const WorldXformCache & iXforms,
+                          const Abc::ISampleSelector &iSS )
+{
+    clear();
+
+    size_t numObjects = iXforms.getNumObjects();
+    std::vector< bool > boundedBelow( numObjects, false );
+    std::vector< bool > isLeaf( numObjects, false );
+    std::vector< Abc::Box3d > localBounds( numObjects );
+
+    for ( size_t i = 0; i < numObjects; ++i )
+    {
+        isLeaf[i] = readBounds( iXforms.getObject( i ), ".geom", ".selfBnds",
+                                iSS, localBounds[i] );
+        boundedBelow[i] = isLeaf[i];
+    }
+
+    // children come after their parents, so going backwards every subtree
+    // is done before its parent is
+    for ( size_t i = numObjects; i > 1; --i )
+    {
+        size_t parent = iXforms.getParentIndex( i - 1 );
+        if ( boundedBelow[i - 1] && parent != WorldXformCache::kInvalidIndex )
+        {
+            boundedBelow[parent] = true;
+        }
+    }
+
+    for ( size_t i = 0; i < numObjects; ++i )
+    {
+        if ( !isLeaf[i] && !boundedBelow[i] &&
+             IXform::matches( iXforms.getObject( i ).getHeader() ) &&
+             readBounds( iXforms.getObject( i ), ".xform", ".childBnds",
+                         iSS, localBounds[i] ) )
+        {
+            isLeaf[i] = true;
+
+            // everything below is covered by this one
+            size_t parent = iXforms.getParentIndex( i );
+            while ( parent != WorldXformCache::kInvalidIndex &&
+                    !boundedBelow[parent] )
+            {
+                boundedBelow[parent] = true;
+                parent = iXforms.getParentIndex( parent );
+            }
+            boundedBelow[i] = true;
+        }
+
+        if ( isLeaf[i] && !localBounds[i].isEmpty() )
+        {
+            m_leafNames.push_back( iXforms.getFullName( i ) );
+            m_leafBounds.push_back( transformBox( localBounds[i],
+                                                  iXforms.getMatrix( i ) ) );
+        }
+    }
+
+    buildNodes();
+}
+
+//-*****************************************************************************
+void SpatialIndex::buildNodes()
+{
+    m_nodes.clear();
+
+    size_t numLeaves = m_leafBounds.size();
+    if ( numLeaves == 0 )
+    {
+        return;
+    }
+
+    std::vector< size_t > order( numLeaves );
+    for ( size_t i = 0; i < numLeaves; ++i )
+    {
+        order[i] = i;
+    }
+
+    std::vector< NodeRange > stack;
+    NodeRange root = { 0, 0, numLeaves };
+    m_nodes.push_back( Node() );
+    stack.push_back( root );
+
+    while ( !stack.empty() )
+    {
+        NodeRange r = stack.back();
+        stack.pop_back();
+
+        Abc::Box3d bounds;
+        Abc::Box3d centers;
+        for ( size_t i = r.begin; i < r.end; ++i )
+        {
+            const Abc::Box3d & b = m_leafBounds[order[i]];
+            bounds.extendBy( b );
+            centers.extendBy( b.center() );
+        }
+
+        Node & node = m_nodes[r.node];
+        node.bounds = bounds;
+
+        size_t count = r.end - r.begin;
+        if ( count <= kMaxLeavesPerNode )
+        {
+            node.first = ( Alembic::Util::uint32_t ) r.begin;
+            node.count = ( Alembic::Util::uint32_t ) count;
+            continue;
+        }
+
+        // split at the median along the longest axis of the centers
+        size_t mid = r.begin + count / 2;
+        std::nth_element( order.begin() + r.begin, order.begin() + mid,
+                          order.begin() + r.end,
+                          CenterLess( m_leafBounds, centers.majorAxis() ) );
+
+        size_t left = m_nodes.size();
+        node.first = ( Alembic::Util::uint32_t ) left;
+        node.count = 0;
+
+        // node is invalid after this
+        m_nodes.push_back( Node() );
+        m_nodes.push_back( Node() );
+
+        NodeRange leftRange = { left, r.begin, mid };
+        NodeRange rightRange = { left + 1, mid, r.end };
+        stack.push_back( rightRange );
+        stack.push_back( leftRange );
+    }
+
+    // put the leaves in the order the nodes refer to them
+    std::vector< std::string > names( numLeaves );
+    std::vector< Abc::Box3d > bounds( numLeaves );
+    for ( size_t i = 0; i < numLeaves; ++i )
+    {
+        names[i].swap( m_leafNames[order[i]] );
+        bounds[i] = m_leafBounds[order[i]];
+    }
+    m_leafNames.swap( names );
+    m_leafBounds.swap( bounds );
+}
+
+//-*****************************************************************************
+Abc::Box3d SpatialIndex::getBounds() const
+{
+    if ( m_nodes.empty() )
+    {
+        return Abc::Box3d();
+    }
+
+    return m_nodes[0].bounds;
+}
+
+//-*****************************************************************************
+template <class INTERSECTS>
+void SpatialIndex::find( const INTERSECTS & iIntersects,
+                         std::vector< size_t > & oLeaves ) const
+{
+    oLeaves.clear();
+
+    if ( m_nodes.empty() )
+    {
+        return;
+    }
+
+    std::vector< size_t > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const Node & node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if ( !iIntersects( node.bounds ) )
+        {
+            continue;
+        }
+
+        if ( node.count == 0 )
+        {
+            stack.push_back( node.first + 1 );
+            stack.push_back( node.first );
+            continue;
+        }
+
+        for ( size_t i = node.first; i < node.first + node.count; ++i )
+        {
+            if ( iIntersects( m_leafBounds[i] ) )
+            {
+                oLeaves.push_back( i );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void SpatialIndex::findIntersecting( const Abc::Box3d & iRegion,
+                                     std::vector< size_t > & oLeaves ) const
+{
+    find( BoxIntersects( iRegion ), oLeaves );
+}
+
+//-*****************************************************************************
+void SpatialIndex::findIntersecting( const Abc::M44d & iWorldToClip,
+                                     std::vector< size_t > & oLeaves ) const
+{
+    find( FrustumIntersects( iWorldToClip ), oLeaves );
+}
+
+//-*****************************************************************************
+bool SpatialIndex::read( Abc::IArchive & iArchive,
+                         const Abc::ISampleSelector &iSS )
+{
+    clear();
+
+    Abc::ICompoundProperty props = iArchive.getTop().getProperties();
+    const AbcA::PropertyHeader * header =
+        props.getPropertyHeader( kSpatialIndexName );
+
+    if ( !header || !header->isCompound() )
+    {
+        return false;
+    }
+
+    Abc::ICompoundProperty index( props, kSpatialIndexName );
+    Abc::IStringArrayProperty namesProp( index, "leafNames" );
+    Abc::IBox3dArrayProperty leafBoundsProp( index, "leafBnds" );
+    Abc::IBox3dArrayProperty nodeBoundsProp( index, "nodeBnds" );
+    Abc::IUInt32ArrayProperty nodesProp( index, "nodes" );
+
+    Abc::StringArraySamplePtr names = namesProp.getValue( iSS );
+    Abc::Box3dArraySamplePtr leafBounds = leafBoundsProp.getValue( iSS );
+    Abc::Box3dArraySamplePtr nodeBounds = nodeBoundsProp.getValue( iSS );
+    Abc::UInt32ArraySamplePtr nodes = nodesProp.getValue( iSS );
+
+    ABCA_ASSERT( names->size() == leafBounds->size() &&
+                 nodes->size() == nodeBounds->size() * 2,
+                 "Mismatched spatial index sizes" );
+
+    m_leafNames.assign( names->get(), names->get() + names->size() );
+    m_leafBounds.assign( leafBounds->get(),
+                         leafBounds->get() + leafBounds->size() );
+
+    m_nodes.resize( nodeBounds->size() );
+    for ( size_t i = 0; i < m_nodes.size(); ++i )
+    {
+        m_nodes[i].bounds = ( *nodeBounds )[i];
+        m_nodes[i].first = ( *nodes )[2 * i];
+        m_nodes[i].count = ( *nodes )[2 * i + 1];
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+OSpatialIndexWriter::OSpatialIndexWriter()
+{
+}
+
+//-*****************************************************************************
+OSpatialIndexWriter::OSpatialIndexWriter(
+    Abc::OArchive & iArchive,
+    Alembic::Util::uint32_t iTimeSamplingIndex )
+{
+    Abc::OCompoundProperty props = iArchive.getTop().getProperties();
+
+    m_index = Abc::OCompoundProperty( props, kSpatialIndexName );
+    m_namesProp = Abc::OStringArrayProperty( m_index, "leafNames",
+                                             iTimeSamplingIndex );
+    m_leafBoundsProp = Abc::OBox3dArrayProperty( m_index, "leafBnds",
+                                                 iTimeSamplingIndex );
+    m_nodeBoundsProp = Abc::OBox3dArrayProperty( m_index, "nodeBnds",
+                                                 iTimeSamplingIndex );
+    m_nodesProp = Abc::OUInt32ArrayProperty( m_index, "nodes",
+                                             iTimeSamplingIndex );
+}
+
+//-*****************************************************************************
+void OSpatialIndexWriter::set( const SpatialIndex & iIndex )
+{
+    ABCA_ASSERT( valid(), "Invalid OSpatialIndexWriter" );
+
+    size_t numLeaves = iIndex.getNumLeaves();
+    std::vector< std::string > names( numLeaves );
+    std::vector< Abc::Box3d > leafBounds( numLeaves );
+    for ( size_t i = 0; i < numLeaves; ++i )
+    {
+        names[i] = iIndex.getLeafName( i );
+        leafBounds[i] = iIndex.getLeafBounds( i );
+    }
+
+    const std::vector< SpatialIndex::Node > & nodes = iIndex.getNodes();
+    std::vector< Abc::Box3d > nodeBounds( nodes.size() );
+    std::vector< Alembic::Util::uint32_t > nodeRanges( nodes.size() * 2 );
+    for ( size_t i = 0; i < nodes.size(); ++i )
+    {
+        nodeBounds[i] = nodes[i].bounds;
+        nodeRanges[2 * i] = nodes[i].first;
+        nodeRanges[2 * i + 1] = nodes[i].count;
+    }
+
+    m_namesProp.set( Abc::StringArraySample( names ) );
+    m_leafBoundsProp.set( Abc::Box3dArraySample( leafBounds ) );
+    m_nodeBoundsProp.set( Abc::Box3dArraySample( nodeBounds ) );
+    m_nodesProp.set( Abc::UInt32ArraySample( nodeRanges ) );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,162 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_SpatialIndex_h_
+#define _Alembic_AbcGeom_SpatialIndex_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/WorldXformCache.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A bounding volume hierarchy over the world space bounds of the objects of
+//! an archive at one point in time, to find the objects inside of a box or a
+//! camera frustum without walking the whole hierarchy.
+//!
+//! The leaves are the objects with .selfBnds, put into world space with the
+//! matrices of a WorldXformCache.  An xform with .childBnds but nothing
+//! bounded below it (for example a stand-in for a deferred load) becomes a
+//! leaf too.
+//!
+//! The index can be stored in the archive with an OSpatialIndexWriter and
+//! read back, so readers don't have to rebuild it.
+class ALEMBIC_EXPORT SpatialIndex
+{
+public:
+    SpatialIndex();
+
+    //! Builds the index from iXforms, which must have been evaluated at iSS.
+    void build( const WorldXformCache & iXforms,
+                const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    //! Builds the index for every object in iArchive at iSS.
+    void build( Abc::IArchive & iArchive,
+                const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    //! Reads an index stored with OSpatialIndexWriter, returns false and leaves
+    //! the index empty if the archive doesn't have one.
+    bool read( Abc::IArchive & iArchive,
+               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    void clear();
+
+    size_t getNumLeaves() const { return m_leafNames.size(); }
+
+    //! The full name of a leaf object.
+    const std::string & getLeafName( size_t iLeaf ) const
+    { return m_leafNames[iLeaf]; }
+
+    //! The world space bounds of a leaf object.
+    const Abc::Box3d & getLeafBounds( size_t iLeaf ) const
+    { return m_leafBounds[iLeaf]; }
+
+    //! The bounds of everything in the index.
+    Abc::Box3d getBounds() const;
+
+    //! Fills oLeaves with the leaves whose bounds intersect iRegion.
+    void findIntersecting( const Abc::Box3d & iRegion,
+                           std::vector< size_t > & oLeaves ) const;
+
+    //! Fills oLeaves with the leaves whose bounds are at least partly inside
+    //! the frustum of iWorldToClip, which goes from world space to clip space
+    //! (-w <= x, y, z <= w).
+    void findIntersecting( const Abc::M44d & iWorldToClip,
+                           std::vector< size_t > & oLeaves ) const;
+
+    //! A node covers either two child nodes, at indices first and first + 1,
+    //! or, when count isn't 0, the leaves first to first + count.
+    struct Node
+    {
+        Abc::Box3d bounds;
+        Alembic::Util::uint32_t first;
+        Alembic::Util::uint32_t count;
+    };
+
+    const std::vector< Node > & getNodes() const { return m_nodes; }
+
+private:
+    void buildNodes();
+
+    template <class INTERSECTS>
+    void find( const INTERSECTS & iIntersects,
+               std::vector< size_t > & oLeaves ) const;
+
+    std::vector< std::string > m_leafNames;
+    std::vector< Abc::Box3d > m_leafBounds;
+    std::vector< Node > m_nodes;
+};
+
+//-*****************************************************************************
+//! Stores spatial indices as the samples of properties on the top object of
+//! an archive, for SpatialIndex::read.  The properties are only kept for as
+//! long as the writer is, so keep it around until the last sample is set.
+class ALEMBIC_EXPORT OSpatialIndexWriter
+{
+public:
+    OSpatialIndexWriter();
+
+    //! Creates the properties on the top object of iArchive, with the time
+    //! sampling at iTimeSamplingIndex.  An archive can only have one.
+    OSpatialIndexWriter( Abc::OArchive & iArchive,
+                         Alembic::Util::uint32_t iTimeSamplingIndex = 0 );
+
+    //! Writes iIndex as the next sample.
+    void set( const SpatialIndex & iIndex );
+
+    size_t getNumSamples() const { return m_nodesProp.getNumSamples(); }
+
+    bool valid() const { return m_index.valid(); }
+
+private:
+    Abc::OCompoundProperty m_index;
+    Abc::OStringArrayProperty m_namesProp;
+    Abc::OBox3dArrayProperty m_leafBoundsProp;
+    Abc::OBox3dArrayProperty m_nodeBoundsProp;
+    Abc::OUInt32ArrayProperty m_nodesProp;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -560,6 +560,85 @@ void readNestedCommpoundWithVis(const std::string &archiveName)
 }
 
 
+//-*****************************************************************************
+void visibilityCacheTest()
+{
+    std::string archiveName( "visibilityCache.abc" );
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        OObject top = archive.getTop();
+        OObject a( top, "a" );
+        OObject b( a, "b" );
+        OObject c( a, "c" );
+        OObject d( top, "d" );
+        OObject e( d, "e" );
+        OObject f( e, "f" );
+
+        OVisibilityProperty aVis = CreateVisibilityProperty( a, 0 );
+        aVis.set( kVisibilityHidden );
+        aVis.set( kVisibilityDeferred );
+        aVis.set( kVisibilityHidden );
+
+        OVisibilityProperty cVis = CreateVisibilityProperty( c, 0 );
+        cVis.set( kVisibilityVisible );
+
+        OVisibilityProperty dVis = CreateVisibilityProperty( d, 0 );
+        dVis.set( kVisibilityHidden );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      archiveName, ErrorHandler::kThrowPolicy );
+
+    // d is always hidden, so e and f are never expanded
+    VisibilityCache cache( archive );
+    TESTING_ASSERT( cache.getNumObjects() == 5 );
+
+    size_t a = cache.getIndex( "/a" );
+    size_t b = cache.getIndex( "/a/b" );
+    size_t c = cache.getIndex( "/a/c" );
+    size_t d = cache.getIndex( "/d" );
+    TESTING_ASSERT( cache.getIndex( "/nope" ) ==
+                    VisibilityCache::kInvalidIndex );
+    TESTING_ASSERT( cache.getIndex( "/d/e" ) ==
+                    VisibilityCache::kInvalidIndex );
+    TESTING_ASSERT( cache.getParentIndex( c ) == a );
+
+    TESTING_ASSERT( !cache.isConstant( a ) && !cache.isConstant( b ) );
+    TESTING_ASSERT( cache.isConstant( c ) && cache.isConstant( d ) );
+
+    for ( index_t i = 0; i < 3; ++i )
+    {
+        cache.evaluate( i );
+
+        // the cache has to agree with walking up from every object
+        for ( size_t j = 0; j < cache.getNumObjects(); ++j )
+        {
+            TESTING_ASSERT( cache.isVisible( j ) ==
+                !IsAncestorInvisible( cache.getObject( j ), i ) );
+        }
+
+        TESTING_ASSERT( cache.isVisible( a ) == ( i == 1 ) );
+        TESTING_ASSERT( cache.isVisible( b ) == ( i == 1 ) );
+        TESTING_ASSERT( cache.isVisible( c ) );
+        TESTING_ASSERT( cache.getVisibility( c ) == kVisibilityVisible );
+        TESTING_ASSERT( cache.getVisibility( b ) == kVisibilityDeferred );
+
+        // c keeps the branch under a alive, nothing under d is visible
+        TESTING_ASSERT( !cache.isSubtreeHidden( a ) );
+        TESTING_ASSERT( cache.isSubtreeHidden( b ) == ( i != 1 ) );
+        TESTING_ASSERT( cache.isSubtreeHidden( d ) );
+        TESTING_ASSERT( !cache.isSubtreeHidden( 0 ) );
+    }
+
+    // starting below d, which hides everything, so f isn't expanded either
+    VisibilityCache eCache( cache.getObject( d ).getChild( "e" ) );
+    eCache.evaluate();
+    TESTING_ASSERT( eCache.getNumObjects() == 1 );
+    TESTING_ASSERT( eCache.isConstant( 0 ) && !eCache.isVisible( 0 ) );
+    TESTING_ASSERT( eCache.isSubtreeHidden( 0 ) );
+}
+
 int main( int argc, char *argv[] )
 {
     try
@@ -578,6 +657,8 @@ int main( int argc, char *argv[] )
         std::string archiveName2("simpleHelperProps.abc");
         writeSimpleProperties(archiveName2);
         readSimpleProperties(archiveName2);
+
+        visibilityCacheTest();
     }
     catch (char * str )
     {
@@ -0,0 +1,273 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+void pointsInterpolationTest()
+{
+    std::string name = "pointsInterpolation.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPoints pointsObj( OObject( archive, kTop ), "points" );
+        OPointsSchema &points = pointsObj.getSchema();
+
+        // 2 points on the first two frames, 3 on the last
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            std::vector<V3f> verts( i < 2 ? 2 : 3,
+                                    V3f( 2.0f * i, 1.0f, -1.0f * i ) );
+            std::vector<uint64_t> ids( verts.size(), 0 );
+            V3fArraySample vertsSamp( verts );
+            UInt64ArraySample idsSamp( ids );
+            OPointsSchema::Sample samp( vertsSamp, idsSamp );
+            points.set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPoints pointsObj( IObject( archive, kTop ), "points" );
+    IP3fArrayInterpolator interp(
+        pointsObj.getSchema().getPositionsProperty() );
+
+    P3fArraySample samp = interp.get( 0.5 );
+    TESTING_ASSERT( samp.size() == 2 );
+    TESTING_ASSERT( samp[0] == V3f( 1.0f, 1.0f, -0.5f ) );
+    TESTING_ASSERT( samp[1] == V3f( 1.0f, 1.0f, -0.5f ) );
+
+    samp = interp.get( 0.25 );
+    TESTING_ASSERT( samp[1] == V3f( 0.5f, 1.0f, -0.25f ) );
+
+    // right on a sample
+    samp = interp.get( 1.0 );
+    TESTING_ASSERT( samp.size() == 2 );
+    TESTING_ASSERT( samp[0] == V3f( 2.0f, 1.0f, -1.0f ) );
+
+    // the number of points changes, so we get the floor as is
+    samp = interp.get( 1.5 );
+    TESTING_ASSERT( samp.size() == 2 );
+    TESTING_ASSERT( samp[0] == V3f( 2.0f, 1.0f, -1.0f ) );
+
+    // outside of the samples
+    samp = interp.get( 10.0 );
+    TESTING_ASSERT( samp.size() == 3 );
+    TESTING_ASSERT( samp[2] == V3f( 4.0f, 1.0f, -2.0f ) );
+
+    samp = interp.get( -10.0 );
+    TESTING_ASSERT( samp[0] == V3f( 0.0f, 1.0f, 0.0f ) );
+
+    index_t floorIndex, ceilIndex;
+    double alpha = GetInterpolationSamples(
+        pointsObj.getSchema().getTimeSampling(), 3, 1.75,
+        floorIndex, ceilIndex );
+    TESTING_ASSERT( floorIndex == 1 && ceilIndex == 2 );
+    TESTING_ASSERT( alpha > 0.75 - VAL_EPSILON && alpha < 0.75 + VAL_EPSILON );
+
+    // only float32_t values can be interpolated
+    TESTING_ASSERT_THROW( ITypedArrayInterpolator<Int32TPTraits>(),
+                          Alembic::Util::Exception );
+    TESTING_ASSERT_THROW( ITypedArrayInterpolator<V3dTPTraits>(),
+                          Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+void xformInterpolationTest()
+{
+    std::string name = "xformInterpolation.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OXform xformObj( OObject( archive, kTop ), "xform" );
+
+        for ( size_t i = 0; i < 2; ++i )
+        {
+            XformSample samp;
+            samp.addOp( XformOp( kTranslateOperation, kTranslateHint ),
+                        V3d( 4.0 * i, 0.0, 0.0 ) );
+            samp.addOp( XformOp( kRotateYOperation, kRotateHint ), 90.0 * i );
+
+            // the axis changes, so this one gets slerped
+            samp.addOp( XformOp( kRotateOperation, kRotateHint ),
+                        i == 0 ? V3d( 1.0, 0.0, 0.0 ) : V3d( 0.0, 0.0, 1.0 ),
+                        90.0 * i );
+
+            M44d m;
+            m.setAxisAngle( V3d( 0.0, 0.0, 1.0 ),
+                            DegreesToRadians( 90.0 * i ) );
+            m[3][1] = 2.0 * i;
+            samp.addOp( XformOp( kMatrixOperation, kMatrixHint ), m );
+            xformObj.getSchema().set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IXform xformObj( IObject( archive, kTop ), "xform" );
+    IXformInterpolator interp( xformObj.getSchema() );
+
+    const XformSample &samp = interp.get( 0.5 );
+    TESTING_ASSERT( samp.getNumOps() == 4 );
+    TESTING_ASSERT( samp[0].getTranslate() == V3d( 2.0, 0.0, 0.0 ) );
+    TESTING_ASSERT( samp[1].getAngle() == 45.0 );
+    TESTING_ASSERT( samp[2].getAxis().equalWithAbsError(
+        V3d( 0.0, 0.0, 1.0 ), VAL_EPSILON ) );
+    TESTING_ASSERT( fabs( samp[2].getAngle() - 45.0 ) < VAL_EPSILON );
+
+    M44d expected;
+    expected.setAxisAngle( V3d( 0.0, 0.0, 1.0 ), DegreesToRadians( 45.0 ) );
+    expected[3][1] = 1.0;
+    TESTING_ASSERT( samp[3].getMatrix().equalWithAbsError( expected,
+                                                          VAL_EPSILON ) );
+
+    // on the samples themselves nothing changes
+    XformSample last;
+    xformObj.getSchema().get( last, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( interp.getMatrix( 1.0 ) == last.getMatrix() );
+    TESTING_ASSERT( interp.getMatrix( 7.0 ) == last.getMatrix() );
+}
+
+//-*****************************************************************************
+void velocityExtrapolationTest()
+{
+    std::string name = "velocityExtrapolation.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPoints pointsObj( OObject( archive, kTop ), "points" );
+        OPointsSchema &points = pointsObj.getSchema();
+
+        // a different number of points each sample
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            std::vector<V3f> verts( i + 1, V3f( 1.0f * i, 0.0f, 0.0f ) );
+            std::vector<V3f> vels( i + 1, V3f( 0.0f, 2.0f, -4.0f ) );
+            std::vector<uint64_t> ids( verts.size(), 0 );
+            V3fArraySample vertsSamp( verts );
+            UInt64ArraySample idsSamp( ids );
+            V3fArraySample velsSamp( vels );
+            OPointsSchema::Sample samp( vertsSamp, idsSamp, velsSamp );
+            points.set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPoints pointsObj( IObject( archive, kTop ), "points" );
+    IPointsSchema &schema = pointsObj.getSchema();
+    IVelocityExtrapolator extrap( schema.getPositionsProperty(),
+                                  schema.getVelocitiesProperty() );
+
+    P3fArraySample samp = extrap.get( 1.25 );
+    TESTING_ASSERT( samp.size() == 2 );
+    TESTING_ASSERT( samp[1] == V3f( 1.0f, 0.5f, -1.0f ) );
+
+    // a shutter around sample 2, both ends from the same sample
+    ISampleSelector ss( ( index_t ) 2 );
+    samp = extrap.get( ss, 1.75 );
+    TESTING_ASSERT( samp.size() == 3 );
+    TESTING_ASSERT( samp[2] == V3f( 2.0f, -0.5f, 1.0f ) );
+    samp = extrap.get( ss, 2.25 );
+    TESTING_ASSERT( samp[0] == V3f( 2.0f, 0.5f, -1.0f ) );
+
+    // right on the sample the positions are returned as is
+    samp = extrap.get( ss, 2.0 );
+    TESTING_ASSERT( samp[0] == V3f( 2.0f, 0.0f, 0.0f ) );
+
+    // the threaded path gives the same answer
+    std::vector<V3f> verts( 1000, V3f( 1.0f, 2.0f, 3.0f ) );
+    std::vector<V3f> vels( 1000, V3f( 1.0f, -1.0f, 0.5f ) );
+    std::vector<V3f> result( 1000 );
+    ExtrapolatePositions( &verts.front(), &vels.front(), verts.size(), 2.0f,
+                          &result.front(), 4 );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+        TESTING_ASSERT( result[i] == V3f( 3.0f, 0.0f, 4.0f ) );
+    }
+
+    // in place
+    ExtrapolatePositions( &verts.front(), &vels.front(), verts.size(), 2.0f,
+                          &verts.front() );
+    TESTING_ASSERT( verts == result );
+}
+
+//-*****************************************************************************
+void constantVelocityExtrapolationTest()
+{
+    std::string name = "constantVelocityExtrapolation.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OCompoundProperty props = archive.getTop().getProperties();
+        OP3fArrayProperty positions( props, "P" );
+        OV3fArrayProperty velocities( props, "v" );
+
+        // the positions move but the velocities are only written once
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            std::vector<V3f> verts( 2, V3f( 1.0f * i, 0.0f, 0.0f ) );
+            positions.set( V3fArraySample( verts ) );
+        }
+
+        std::vector<V3f> vels( 2, V3f( 0.0f, 2.0f, -4.0f ) );
+        velocities.set( V3fArraySample( vels ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    ICompoundProperty props = archive.getTop().getProperties();
+    IVelocityExtrapolator extrap( IP3fArrayProperty( props, "P" ),
+                                  IV3fArrayProperty( props, "v" ) );
+
+    P3fArraySample samp = extrap.get( 0.5 );
+    TESTING_ASSERT( samp[0] == V3f( 0.0f, 1.0f, -2.0f ) );
+
+    // past the first sample the one velocity sample still applies
+    samp = extrap.get( 2.25 );
+    TESTING_ASSERT( samp.size() == 2 );
+    TESTING_ASSERT( samp[1] == V3f( 2.0f, 0.5f, -1.0f ) );
+
+    samp = extrap.get( ISampleSelector( ( index_t ) 1 ), 1.5 );
+    TESTING_ASSERT( samp[0] == V3f( 1.0f, 1.0f, -2.0f ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    pointsInterpolationTest();
+    xformInterpolationTest();
+    velocityExtrapolationTest();
+    constantVelocityExtrapolationTest();
+    return 0;
+}
@@ -481,6 +481,216 @@ void optPropTest()
 // Particles Test
 //-*****************************************************************************
 //-*****************************************************************************
+//-*****************************************************************************
+void boundsTest()
+{
+    // enough to go parallel on its own
+    std::vector< V3f > positions( 3 << 19 );
+    Imath::Rand48 rand48( 7 );
+    for ( size_t i = 0; i < positions.size(); ++i )
+    {
+        positions[i] = V3f( rand48.nextf( -100.0, 100.0 ),
+                            rand48.nextf( -5.0, 5.0 ),
+                            rand48.nextf( 0.0, 1.0 ) );
+    }
+    positions[12345] = V3f( -200.0f, 0.0f, 0.0f );
+    positions.back() = V3f( 0.0f, 0.0f, 2.0f );
+
+    Box3d expected;
+    for ( size_t i = 0; i < positions.size(); ++i )
+    {
+        expected.extendBy( positions[i] );
+    }
+
+    P3fArraySample samp( &positions[0], positions.size() );
+    TESTING_ASSERT( ComputeBoundsFromPositions( samp ) == expected );
+    TESTING_ASSERT( expected.min.x == -200.0 && expected.max.z == 2.0 );
+
+    for ( size_t numThreads = 1; numThreads < 8; ++numThreads )
+    {
+        TESTING_ASSERT( ComputeBoundsFromPositions( &positions[0],
+            positions.size(), numThreads ) == expected );
+    }
+
+    // more threads than positions, and nothing at all
+    TESTING_ASSERT( ComputeBoundsFromPositions( &positions[0], 3, 8 ) ==
+        ComputeBoundsFromPositions( V3fArraySample( &positions[0], 3 ) ) );
+    TESTING_ASSERT( ComputeBoundsFromPositions( NULL, 0 ).isEmpty() );
+}
+
+//-*****************************************************************************
+void spatialBricksTest()
+{
+    std::string name = "pointsBricks.abc";
+    size_t numPoints = 10000;
+    std::vector< V3f > positions( numPoints );
+    std::vector< V3f > velocities( numPoints );
+    std::vector< Alembic::Util::uint64_t > ids( numPoints );
+    Imath::Rand48 rand48( 11 );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        positions[i] = V3f( rand48.nextf( -10.0, 10.0 ),
+                            rand48.nextf( -10.0, 10.0 ),
+                            rand48.nextf( -10.0, 10.0 ) );
+        velocities[i] = positions[i] * 2.0f;
+        ids[i] = i;
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPoints pointsObj( OObject( archive, kTop ), "points" );
+        OPointsSchema &points = pointsObj.getSchema();
+        points.setSpatialBrickSize( 256 );
+
+        V3fArraySample posSamp( positions );
+        UInt64ArraySample idsSamp( ids );
+        V3fArraySample velSamp( velocities );
+        OPointsSchema::Sample samp( posSamp, idsSamp, velSamp );
+        points.set( samp );
+
+        // no ids so it can't be sorted, and is written as one brick
+        OPointsSchema::Sample unsorted( posSamp, velSamp );
+        points.set( unsorted );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPoints pointsObj( IObject( archive, kTop ), "points" );
+    IPointsSchema &points = pointsObj.getSchema();
+    TESTING_ASSERT( points.hasSpatialBricks() );
+
+    // everything is still there, just in a different order
+    IPointsSchema::Sample all;
+    points.get( all );
+    TESTING_ASSERT( all.getPositions()->size() == numPoints );
+    std::vector< bool > seen( numPoints, false );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        Alembic::Util::uint64_t id = ( *all.getIds() )[i];
+        TESTING_ASSERT( ( *all.getPositions() )[i] == positions[id] );
+        TESTING_ASSERT( ( *all.getVelocities() )[i] == velocities[id] );
+        seen[id] = true;
+    }
+    TESTING_ASSERT( std::find( seen.begin(), seen.end(), false ) ==
+                    seen.end() );
+
+    Box3d region( V3d( 2.0, 2.0, 2.0 ), V3d( 5.0, 5.0, 5.0 ) );
+    IPointsSchema::Sample part;
+    points.getRegion( part, region );
+    size_t numPart = part.getPositions()->size();
+    TESTING_ASSERT( numPart < numPoints / 4 );
+    TESTING_ASSERT( part.getIds()->size() == numPart );
+    TESTING_ASSERT( part.getVelocities()->size() == numPart );
+
+    // every point in the region came back
+    size_t numInside = 0;
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        if ( region.intersects( V3d( positions[i] ) ) ) { ++numInside; }
+    }
+    size_t numPartInside = 0;
+    for ( size_t i = 0; i < numPart; ++i )
+    {
+        V3f p = ( *part.getPositions() )[i];
+        TESTING_ASSERT( p == positions[ ( *part.getIds() )[i] ] );
+        if ( region.intersects( V3d( p ) ) ) { ++numPartInside; }
+    }
+    TESTING_ASSERT( numInside > 0 && numInside == numPartInside );
+
+    // a frustum looking down -z from the origin only sees half of them
+    M44d proj( 1.0, 0.0, 0.0, 0.0,
+               0.0, 1.0, 0.0, 0.0,
+               0.0, 0.0, -1.0, -1.0,
+               0.0, 0.0, -0.2, 0.0 );
+    points.getRegion( part, proj );
+    numPart = part.getPositions()->size();
+    TESTING_ASSERT( numPart > 0 && numPart < numPoints * 3 / 4 );
+
+    // the unsorted sample is one brick
+    IPointsSchema::PointRanges ranges;
+    points.getBrickRanges( region, ranges, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( ranges.size() == 1 && ranges[0].first == 0 &&
+                    ranges[0].second == numPoints );
+}
+
+//-*****************************************************************************
+void spatialBricksArbGeomParamTest()
+{
+    std::string name = "pointsBricksArbGeomParam.abc";
+    size_t numPoints = 1000;
+    std::vector< V3f > positions( numPoints );
+    std::vector< Alembic::Util::uint64_t > ids( numPoints );
+    std::vector< float > ages( numPoints );
+    Imath::Rand48 rand48( 7 );
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        positions[i] = V3f( rand48.nextf( -10.0, 10.0 ),
+                            rand48.nextf( -10.0, 10.0 ),
+                            rand48.nextf( -10.0, 10.0 ) );
+        ids[i] = i;
+        ages[i] = positions[i].x;
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPoints pointsObj( OObject( archive, kTop ), "points" );
+        OPointsSchema &points = pointsObj.getSchema();
+        points.setSpatialBrickSize( 64 );
+
+        OFloatGeomParam age( points.getArbGeomParams(), "age", false,
+                             kVaryingScope, 1 );
+
+        V3fArraySample posSamp( positions );
+        UInt64ArraySample idsSamp( ids );
+        OPointsSchema::Sample samp( posSamp, idsSamp );
+        points.set( samp );
+        age.set( OFloatGeomParam::Sample( FloatArraySample( ages ),
+                                          kVaryingScope ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPoints pointsObj( IObject( archive, kTop ), "points" );
+    IPointsSchema &points = pointsObj.getSchema();
+
+    // the points are sorted, while the arbGeomParam is in the order it was
+    // written in, the sort order maps one onto the other
+    IPointsSchema::Sample all;
+    points.get( all );
+    IFloatGeomParam age( points.getArbGeomParams(), "age" );
+    FloatArraySamplePtr agesRead = age.getExpandedValue().getVals();
+    UInt64ArraySamplePtr order;
+    points.getSortOrder( order );
+    TESTING_ASSERT( all.getPositions()->size() == numPoints );
+    TESTING_ASSERT( agesRead->size() == numPoints );
+    TESTING_ASSERT( order->size() == numPoints );
+    bool sorted = false;
+    for ( size_t i = 0; i < numPoints; ++i )
+    {
+        size_t given = ( *order )[i];
+        sorted = sorted || given != i;
+        TESTING_ASSERT( ( *all.getIds() )[i] == given );
+        TESTING_ASSERT( ( *agesRead )[given] ==
+                        ( *all.getPositions() )[i].x );
+    }
+    TESTING_ASSERT( sorted );
+
+    // and the same for only the points of a region
+    IPointsSchema::PointRanges ranges;
+    Box3d region( V3d( 2.0, 2.0, 2.0 ), V3d( 5.0, 5.0, 5.0 ) );
+    points.getBrickRanges( region, ranges );
+    TESTING_ASSERT( !ranges.empty() );
+
+    IPointsSchema::Sample part;
+    points.getRanges( part, ranges );
+    points.getSortOrder( order, ranges );
+    TESTING_ASSERT( part.getPositions()->size() < numPoints );
+    TESTING_ASSERT( order->size() == part.getPositions()->size() );
+    for ( size_t i = 0; i < order->size(); ++i )
+    {
+        TESTING_ASSERT( ( *agesRead )[ ( *order )[i] ] ==
+                        ( *part.getPositions() )[i].x );
+    }
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -511,5 +721,11 @@ int main( int argc, char *argv[] )
 
     optPropTest();
 
+    boundsTest();
+
+    spatialBricksTest();
+
+    spatialBricksArbGeomParamTest();
+
     return 0;
 }
@@ -355,6 +355,129 @@ void optPropTest()
     }
 }
 
+//-*****************************************************************************
+void expandedCacheTest()
+{
+    std::string name = "meshExpandedCacheTest.abc";
+    const V2f vals[] = { V2f( 0.0f, 0.0f ), V2f( 1.0f, 0.0f ),
+                         V2f( 1.0f, 1.0f ) };
+    const uint32_t indices[] = { 0, 1, 2, 2, 1, 0 };
+    const uint32_t otherIndices[] = { 2, 2, 2, 0, 0, 0 };
+    const uint32_t badIndices[] = { 0, 5, 1, 1, 1, 1 };
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OObject top = archive.getTop();
+
+        const uint32_t * objIndices[] = { indices, indices, otherIndices,
+                                          badIndices };
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            std::ostringstream strm;
+            strm << "uvs" << i;
+            OV2fGeomParam param( top.getProperties(), strm.str(), true,
+                                 kFacevaryingScope, 1 );
+            OV2fGeomParam::Sample samp( V2fArraySample( vals, 3 ),
+                UInt32ArraySample( objIndices[i], 6 ), kFacevaryingScope );
+
+            // the same on both frames
+            param.set( samp );
+            param.set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    ICompoundProperty props = archive.getTop().getProperties();
+    IV2fGeomParam uvs0( props, "uvs0" );
+    IV2fGeomParam uvs1( props, "uvs1" );
+    IV2fGeomParam uvs2( props, "uvs2" );
+    IV2fGeomParam uvs3( props, "uvs3" );
+
+    V2fArraySamplePtr expanded =
+        uvs0.getExpandedValue( ISampleSelector( ( index_t ) 0 ) ).getVals();
+    TESTING_ASSERT( expanded->size() == 6 );
+    for ( size_t i = 0; i < 6; ++i )
+    {
+        TESTING_ASSERT( ( *expanded )[i] == vals[ indices[i] ] );
+    }
+
+    // the other frame, and the other object with the same data, share it
+    TESTING_ASSERT( expanded == uvs0.getExpandedValue(
+        ISampleSelector( ( index_t ) 1 ) ).getVals() );
+    TESTING_ASSERT( expanded == uvs1.getExpandedValue().getVals() );
+
+    V2fArraySamplePtr other = uvs2.getExpandedValue().getVals();
+    TESTING_ASSERT( other != expanded );
+    TESTING_ASSERT( ( *other )[0] == vals[2] && ( *other )[5] == vals[0] );
+
+    // once nothing holds on to it, it gets expanded again
+    expanded.reset();
+    other.reset();
+    expanded = uvs1.getExpandedValue().getVals();
+    TESTING_ASSERT( ( *expanded )[2] == vals[2] );
+
+    TESTING_ASSERT_THROW( uvs3.getExpandedValue(),
+                          Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+void homogeneousTopologyTest()
+{
+    std::string name = "meshHomogeneousTopology.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPolyMesh meshyObj( OObject( archive, kTop ), "meshy" );
+        OPolyMeshSchema &mesh = meshyObj.getSchema();
+
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            std::vector<V3f> verts( ( const V3f * ) g_verts,
+                                    ( const V3f * ) g_verts + g_numVerts );
+            verts[0].x += i;
+
+            ON3fGeomParam::Sample nsamp( N3fArraySample(
+                ( const N3f * ) g_normals, g_numNormals ),
+                kFacevaryingScope );
+
+            OPolyMeshSchema::Sample samp(
+                V3fArraySample( verts ),
+                Int32ArraySample( g_indices, g_numIndices ),
+                Int32ArraySample( g_counts, g_numCounts ),
+                OV2fGeomParam::Sample(), nsamp );
+            mesh.set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPolyMesh meshyObj( IObject( archive, kTop ), "meshy" );
+    IPolyMeshSchema &mesh = meshyObj.getSchema();
+    TESTING_ASSERT( mesh.getTopologyVariance() == kHomogenousTopology );
+
+    IPolyMeshSchema::Sample samp0;
+    mesh.get( samp0, ISampleSelector( ( index_t ) 0 ) );
+    IPolyMeshSchema::Sample samp2;
+    mesh.get( samp2, ISampleSelector( ( index_t ) 2 ) );
+
+    // the topology is only read once
+    TESTING_ASSERT( samp0.getFaceIndices() == samp2.getFaceIndices() );
+    TESTING_ASSERT( samp0.getFaceCounts() == samp2.getFaceCounts() );
+    TESTING_ASSERT( samp0.getFaceIndices()->size() == g_numIndices );
+    TESTING_ASSERT( ( *samp2.getPositions() )[0].x == g_verts[0] + 2.0f );
+
+    // and a copy of the schema shares it
+    IPolyMeshSchema meshCopy = mesh;
+    IPolyMeshSchema::Sample sampCopy;
+    meshCopy.get( sampCopy, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( sampCopy.getFaceIndices() == samp0.getFaceIndices() );
+
+    // only the parts that change get updated
+    Int32ArraySamplePtr indices = samp0.getFaceIndices();
+    IN3fGeomParam::Sample normals;
+    mesh.getVarying( samp0, normals, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( samp0.getFaceIndices() == indices );
+    TESTING_ASSERT( ( *samp0.getPositions() )[0].x == g_verts[0] + 1.0f );
+    TESTING_ASSERT( normals.getVals()->size() == g_numNormals );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -374,5 +497,7 @@ int main( int argc, char *argv[] )
     meshUnderXformOut( "animatedXformedMesh.abc" );
 
     optPropTest();
+    expandedCacheTest();
+    homogeneousTopologyTest();
     return 0;
 }
@@ -0,0 +1,222 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <algorithm>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// A grid of 20 by 20 xforms 10 units apart, each with a unit sized points
+// object under it, and one xform stand-in with only child bounds.
+void writeGrid( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject top( archive, kTop );
+
+    std::vector<V3f> verts;
+    verts.push_back( V3f( -0.5f, -0.5f, -0.5f ) );
+    verts.push_back( V3f( 0.5f, 0.5f, 0.5f ) );
+    std::vector<Alembic::Util::uint64_t> ids( 2, 0 );
+    V3fArraySample vertsSamp( verts );
+    UInt64ArraySample idsSamp( ids );
+
+    for ( int i = 0; i < 20; ++i )
+    {
+        for ( int j = 0; j < 20; ++j )
+        {
+            std::ostringstream name;
+            name << "xf_" << i << "_" << j;
+            OXform xf( top, name.str() );
+            XformSample xs;
+            xs.setTranslation( V3d( 10.0 * i, 10.0 * j, 0.0 ) );
+            xf.getSchema().set( xs );
+
+            OPoints pts( xf, "points" );
+            pts.getSchema().set( OPointsSchema::Sample( vertsSamp,
+                                                        idsSamp ) );
+        }
+    }
+
+    OXform proxy( top, "proxy" );
+    XformSample xs;
+    xs.setTranslation( V3d( 1000.0, 0.0, 0.0 ) );
+    proxy.getSchema().set( xs );
+    proxy.getSchema().getChildBoundsProperty().set(
+        Box3d( V3d( -5.0 ), V3d( 5.0 ) ) );
+}
+
+//-*****************************************************************************
+void bruteForce( const SpatialIndex & iIndex, const Box3d & iRegion,
+                 std::vector< size_t > & oLeaves )
+{
+    oLeaves.clear();
+    for ( size_t i = 0; i < iIndex.getNumLeaves(); ++i )
+    {
+        if ( iRegion.intersects( iIndex.getLeafBounds( i ) ) )
+        {
+            oLeaves.push_back( i );
+        }
+    }
+}
+
+//-*****************************************************************************
+void checkQueries( const SpatialIndex & iIndex )
+{
+    TESTING_ASSERT( iIndex.getNumLeaves() == 401 );
+
+    Box3d bounds = iIndex.getBounds();
+    TESTING_ASSERT( bounds.min.equalWithAbsError( V3d( -0.5, -5.0, -5.0 ),
+                                                  1e-6 ) );
+    TESTING_ASSERT( bounds.max.equalWithAbsError( V3d( 1005.0, 190.5, 5.0 ),
+                                                  1e-6 ) );
+
+    std::vector< size_t > found;
+    std::vector< size_t > expected;
+
+    // the 4 points objects around ( 15, 15 )
+    Box3d region( V3d( 9.0, 9.0, -1.0 ), V3d( 21.0, 21.0, 1.0 ) );
+    iIndex.findIntersecting( region, found );
+    TESTING_ASSERT( found.size() == 4 );
+
+    std::vector< std::string > names;
+    for ( size_t i = 0; i < found.size(); ++i )
+    {
+        names.push_back( iIndex.getLeafName( found[i] ) );
+    }
+    std::sort( names.begin(), names.end() );
+    TESTING_ASSERT( names[0] == "/xf_1_1/points" );
+    TESTING_ASSERT( names[3] == "/xf_2_2/points" );
+
+    // the stand-in
+    iIndex.findIntersecting( Box3d( V3d( 998.0 ), V3d( 999.0 ) ), found );
+    TESTING_ASSERT( found.empty() );
+    iIndex.findIntersecting( Box3d( V3d( 998.0, -1.0, -1.0 ),
+                                    V3d( 999.0, 1.0, 1.0 ) ), found );
+    TESTING_ASSERT( found.size() == 1 &&
+                    iIndex.getLeafName( found[0] ) == "/proxy" );
+
+    // a bunch of regions, against checking every leaf
+    for ( int k = 0; k < 50; ++k )
+    {
+        V3d corner( ( k * 37 ) % 200 - 5.0, ( k * 53 ) % 200 - 5.0, -1.0 );
+        V3d size( ( k * 7 ) % 40, ( k * 11 ) % 40, 2.0 );
+        Box3d r( corner, corner + size );
+
+        iIndex.findIntersecting( r, found );
+        bruteForce( iIndex, r, expected );
+        std::sort( found.begin(), found.end() );
+        TESTING_ASSERT( found == expected );
+    }
+
+    // looking down -z from ( 0, 0, 50 ), with a 90 degree field of view
+    // which sees |x|, |y| <= 50 at z = 0
+    M44d toClip( 1, 0, 0, 0,
+                 0, 1, 0, 0,
+                 0, 0, -1, -1,
+                 0, 0, 0, 0 );
+    M44d toCamera;
+    toCamera.setTranslation( V3d( 0.0, 0.0, -50.0 ) );
+    iIndex.findIntersecting( toCamera * toClip, found );
+
+    // x and y from 0 to 50 give 6 by 6 points objects
+    TESTING_ASSERT( found.size() == 36 );
+    for ( size_t i = 0; i < found.size(); ++i )
+    {
+        Box3d b = iIndex.getLeafBounds( found[i] );
+        TESTING_ASSERT( b.min.x < 51.0 && b.min.y < 51.0 );
+    }
+}
+
+//-*****************************************************************************
+void spatialIndexTest()
+{
+    writeGrid( "spatialIndexGrid.abc" );
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "spatialIndexGrid.abc" );
+
+    SpatialIndex index;
+    TESTING_ASSERT( !index.read( archive ) );
+
+    index.build( archive );
+    checkQueries( index );
+
+    // just the one points object under xf_3_4
+    WorldXformCache xforms( archive.getTop().getChild( "xf_3_4" ) );
+    xforms.evaluate();
+    SpatialIndex smallIndex;
+    smallIndex.build( xforms );
+    TESTING_ASSERT( smallIndex.getNumLeaves() == 1 );
+
+    // store both as two samples, and read them back
+    {
+        OArchive out( Alembic::AbcCoreOgawa::WriteArchive(),
+                      "spatialIndexStored.abc" );
+        uint32_t tsIndex = out.addTimeSampling(
+            TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+        OSpatialIndexWriter writer( out, tsIndex );
+        writer.set( index );
+        writer.set( smallIndex );
+        TESTING_ASSERT( writer.getNumSamples() == 2 );
+    }
+
+    IArchive stored( Alembic::AbcCoreOgawa::ReadArchive(),
+                     "spatialIndexStored.abc" );
+    SpatialIndex readIndex;
+    TESTING_ASSERT( readIndex.read( stored, 0 ) );
+    TESTING_ASSERT( readIndex.getNodes().size() == index.getNodes().size() );
+    checkQueries( readIndex );
+
+    TESTING_ASSERT( readIndex.read( stored, 1 ) );
+    TESTING_ASSERT( readIndex.getNumLeaves() == 1 );
+    TESTING_ASSERT( readIndex.getNodes().size() == 1 );
+    TESTING_ASSERT( readIndex.getLeafName( 0 ) == "/xf_3_4/points" );
+    TESTING_ASSERT( readIndex.getLeafBounds( 0 ) ==
+                    smallIndex.getLeafBounds( 0 ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    spatialIndexTest();
+    return 0;
+}
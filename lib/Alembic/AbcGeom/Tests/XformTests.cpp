@@ -465,12 +465,188 @@ void someOpsXform()
             double iVal = static_cast< double >( i );
             TESTING_ASSERT( b == Box3d( V3d( -iVal, -iVal, -iVal ),
                                         V3d(  iVal,  iVal,  iVal ) ) );
+
+            // the fast path has to compose the same matrix as the sample
+            std::vector<Alembic::Util::float64_t> channels;
+            M44d m;
+            TESTING_ASSERT( a.getSchema().getMatrix( m, channels,
+                                                     ISampleSelector( i ) ) );
+            TESTING_ASSERT( channels.size() ==
+                            a.getSchema().getNumOpChannels() );
+            TESTING_ASSERT( m == asamp.getMatrix() );
         }
 
         std::cout << "tested all xforms in " << name << std::endl;
     }
 }
 
+//-*****************************************************************************
+void worldXformCacheTest()
+{
+    std::string name = "worldXformCache.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+
+        OXform a( OObject( archive, kTop ), "a" );
+        XformSample asamp;
+        asamp.setTranslation( V3d( 1.0, 0.0, 0.0 ) );
+        a.getSchema().set( asamp );
+
+        OXform b( a, "b" );
+        OObject c( b, "c" );
+        OXform d( a, "d" );
+        OXform e( a, "e" );
+        XformSample dsamp;
+        d.getSchema().set( dsamp );
+
+        for ( index_t i = 0; i < 5; ++i )
+        {
+            XformSample bsamp;
+            bsamp.setTranslation( V3d( 0.0, i, 0.0 ) );
+            b.getSchema().set( bsamp );
+
+            XformSample esamp;
+            esamp.setScale( V3d( i + 1.0, 1.0, 1.0 ) );
+            esamp.setInheritsXforms( false );
+            e.getSchema().set( esamp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    WorldXformCache cache( archive );
+
+    TESTING_ASSERT( cache.getNumObjects() == 6 );
+    TESTING_ASSERT( cache.getIndex( "/nothere" ) ==
+                    WorldXformCache::kInvalidIndex );
+
+    size_t a = cache.getIndex( "/a" );
+    size_t b = cache.getIndex( "/a/b" );
+    size_t c = cache.getIndex( "/a/b/c" );
+    size_t d = cache.getIndex( "/a/d" );
+    size_t e = cache.getIndex( "/a/e" );
+
+    TESTING_ASSERT( cache.getParentIndex( 0 ) ==
+                    WorldXformCache::kInvalidIndex );
+    TESTING_ASSERT( cache.getParentIndex( c ) == b );
+    TESTING_ASSERT( cache.getParentIndex( b ) == a );
+    TESTING_ASSERT( a < b && b < c );
+    TESTING_ASSERT( cache.getFullName( d ) == "/a/d" );
+
+    TESTING_ASSERT( cache.isConstant( a ) );
+    TESTING_ASSERT( cache.isConstant( d ) );
+    TESTING_ASSERT( !cache.isConstant( b ) );
+    TESTING_ASSERT( !cache.isConstant( c ) );
+    TESTING_ASSERT( !cache.isConstant( e ) );
+
+    for ( index_t i = 0; i < 5; ++i )
+    {
+        cache.evaluate( ISampleSelector( i ) );
+        const M44d * mats = cache.getMatrices();
+
+        TESTING_ASSERT( mats[a].translation() == V3d( 1.0, 0.0, 0.0 ) );
+        TESTING_ASSERT( mats[d] == mats[a] );
+        TESTING_ASSERT( mats[b].translation() == V3d( 1.0, i, 0.0 ) );
+        TESTING_ASSERT( mats[c] == mats[b] );
+
+        // doesn't inherit, so the translation of a isn't there
+        M44d scl;
+        scl.setScale( V3d( i + 1.0, 1.0, 1.0 ) );
+        TESTING_ASSERT( mats[e] == scl );
+    }
+}
+
+//-*****************************************************************************
+void composeOpsTest()
+{
+    // a Maya style stack with pivots, all of the single axis rotations, an
+    // arbitrary axis rotation and a shear matrix
+    XformSample samp;
+    samp.addOp( XformOp( kTranslateOperation, kTranslateHint ),
+                V3d( 1.0, 2.0, 3.0 ) );
+    samp.addOp( XformOp( kTranslateOperation, kRotatePivotPointHint ),
+                V3d( 0.5, 0.0, -0.5 ) );
+    samp.addOp( XformOp( kRotateZOperation, kRotateHint ), 30.0 );
+    samp.addOp( XformOp( kRotateYOperation, kRotateHint ), -45.0 );
+    samp.addOp( XformOp( kRotateXOperation, kRotateHint ), 60.0 );
+    samp.addOp( XformOp( kTranslateOperation, kRotatePivotPointHint ),
+                V3d( -0.5, 0.0, 0.5 ) );
+    samp.addOp( XformOp( kRotateOperation, kRotateHint ),
+                V3d( 1.0, 1.0, 0.0 ), 20.0 );
+    M44d shear;
+    shear.makeIdentity();
+    shear.x[1][0] = 0.25;
+    samp.addOp( XformOp( kMatrixOperation, kMayaShearHint ), shear );
+    samp.addOp( XformOp( kScaleOperation, kScaleHint ),
+                V3d( 2.0, 3.0, 4.0 ) );
+
+    // the same thing done the long way, one full matrix per op
+    M44d expected;
+    expected.makeIdentity();
+    std::vector<Alembic::Util::float64_t> channels;
+    std::vector<XformOperationType> ops;
+    for ( size_t i = 0; i < samp.getNumOps(); ++i )
+    {
+        M44d m;
+        XformOp op = samp[i];
+        switch ( op.getType() )
+        {
+            case kTranslateOperation:
+                m.setTranslation( op.getTranslate() ); break;
+            case kScaleOperation:
+                m.setScale( op.getScale() ); break;
+            case kMatrixOperation:
+                m = op.getMatrix(); break;
+            case kRotateOperation:
+            case kRotateXOperation:
+            case kRotateYOperation:
+            case kRotateZOperation:
+                m.setAxisAngle( op.getAxis(),
+                                DegreesToRadians( op.getAngle() ) );
+                break;
+        }
+        expected = m * expected;
+
+        ops.push_back( op.getType() );
+        for ( size_t j = 0; j < op.getNumChannels(); ++j )
+        {
+            channels.push_back( op.getChannelValue( j ) );
+        }
+    }
+
+    M44d result = samp.getMatrix();
+    TESTING_ASSERT( result.equalWithAbsError( expected, VAL_EPSILON ) );
+    TESTING_ASSERT( ComposeXformOps( &ops.front(), ops.size(),
+                                     &channels.front() ) == result );
+
+    // the batch version, with the translate animated over 3 samples
+    size_t numSamples = 3;
+    std::vector<Alembic::Util::float64_t> soa;
+    for ( size_t c = 0; c < channels.size(); ++c )
+    {
+        for ( size_t s = 0; s < numSamples; ++s )
+        {
+            soa.push_back( c == 0 ? channels[c] + s : channels[c] );
+        }
+    }
+
+    std::vector<M44d> mats( numSamples );
+    ComposeXformOps( &ops.front(), ops.size(), &soa.front(), numSamples,
+                     &mats.front() );
+    TESTING_ASSERT( mats[0] == result );
+    for ( size_t s = 1; s < numSamples; ++s )
+    {
+        channels[0] = 1.0 + s;
+        TESTING_ASSERT( mats[s] == ComposeXformOps( &ops.front(),
+            ops.size(), &channels.front() ) );
+        TESTING_ASSERT( mats[s].translation().equalWithAbsError(
+            result.translation() + V3d( s, 0.0, 0.0 ), VAL_EPSILON ) );
+    }
+
+    // a lone matrix comes back as is
+    XformOperationType matOp = kMatrixOperation;
+    TESTING_ASSERT( ComposeXformOps( &matOp, 1, &shear.x[0][0] ) == shear );
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -478,6 +654,8 @@ int main( int argc, char *argv[] )
     xformIn();
     someOpsXform();
     xformTreeCreate();
+    worldXformCacheTest();
+    composeOpsTest();
 
     return 0;
 }
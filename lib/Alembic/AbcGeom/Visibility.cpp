@@ -147,6 +147,146 @@ bool IsAncestorInvisible( IObject iObject,
     return false;
 }
 
+//-*****************************************************************************
+VisibilityCache::VisibilityCache()
+    : m_rootConstant( true )
+    , m_rootHidden( false )
+    , m_evaluated( false )
+{
+}
+
+//-*****************************************************************************
+VisibilityCache::VisibilityCache( const Abc::IObject & iRoot )
+    : m_rootConstant( true )
+    , m_rootHidden( false )
+    , m_evaluated( false )
+{
+    init( iRoot );
+}
+
+//-*****************************************************************************
+VisibilityCache::VisibilityCache( Abc::IArchive & iArchive )
+    : m_rootConstant( true )
+    , m_rootHidden( false )
+    , m_evaluated( false )
+{
+    init( iArchive.getTop() );
+}
+
+//-*****************************************************************************
+void VisibilityCache::init( const Abc::IObject & iRoot )
+{
+    if ( !iRoot.valid() )
+    {
+        return;
+    }
+
+    // the root is constant only if everything above it is
+    m_rootParent = iRoot.getParent();
+    for ( IObject obj = m_rootParent; obj.valid(); obj = obj.getParent() )
+    {
+        IVisibilityProperty prop = GetVisibilityProperty( obj );
+        if ( prop.valid() && !prop.isConstant() )
+        {
+            m_rootConstant = false;
+            break;
+        }
+    }
+
+    m_rootHidden = m_rootConstant && m_rootParent.valid() &&
+        IsAncestorInvisible( m_rootParent );
+
+    flatten( iRoot );
+
+    m_constantHidden.clear();
+    m_values.resize( m_objects.size(), kVisibilityDeferred );
+    m_visible.resize( m_objects.size(), true );
+    m_subtreeVisible.resize( m_objects.size(), true );
+}
+
+//-*****************************************************************************
+bool VisibilityCache::addObject( const Abc::IObject & iObject, size_t iIndex,
+                                 size_t iParent )
+{
+    Abc::IObject obj( iObject );
+    m_properties.push_back( GetVisibilityProperty( obj ) );
+    const IVisibilityProperty & prop = m_properties.back();
+
+    bool isConstant = ( iParent == kInvalidIndex ?
+        m_rootConstant : m_isConstant[iParent] );
+    bool isHidden = ( iParent == kInvalidIndex ?
+        m_rootHidden : m_constantHidden[iParent] );
+
+    // an explicit value doesn't depend on the parent
+    if ( prop.valid() && prop.isConstant() && prop.getNumSamples() > 0 )
+    {
+        int8_t value = prop.getValue();
+        if ( value != kVisibilityDeferred )
+        {
+            isConstant = true;
+            isHidden = ( value == kVisibilityHidden );
+        }
+    }
+    else if ( prop.valid() && !prop.isConstant() )
+    {
+        isConstant = false;
+    }
+
+    isHidden = isHidden && isConstant;
+
+    m_isConstant.push_back( isConstant );
+    m_constantHidden.push_back( isHidden );
+
+    // nothing below something that is always hidden can ever be visible
+    return !isHidden;
+}
+
+//-*****************************************************************************
+void VisibilityCache::evaluate( const Abc::ISampleSelector &iSS )
+{
+    bool rootVisible = true;
+    if ( m_rootParent.valid() )
+    {
+        rootVisible = !IsAncestorInvisible( m_rootParent, iSS );
+    }
+
+    size_t numObjects = m_objects.size();
+    for ( size_t i = 0; i < numObjects; ++i )
+    {
+        const IVisibilityProperty & prop = m_properties[i];
+        if ( prop.valid() && prop.getNumSamples() > 0 &&
+             ( !m_evaluated || !prop.isConstant() ) )
+        {
+            m_values[i] = prop.getValue( iSS );
+        }
+
+        if ( m_values[i] == kVisibilityDeferred )
+        {
+            size_t parent = m_parents[i];
+            m_visible[i] = ( parent == kInvalidIndex ?
+                rootVisible : m_visible[parent] );
+        }
+        else
+        {
+            m_visible[i] = ( m_values[i] != kVisibilityHidden );
+        }
+
+        m_subtreeVisible[i] = m_visible[i];
+    }
+
+    // children come after their parents, so going backwards every subtree
+    // is done before its parent is
+    for ( size_t i = numObjects; i > 1; --i )
+    {
+        if ( m_subtreeVisible[i - 1] )
+        {
+            m_subtreeVisible[m_parents[i - 1]] = true;
+        }
+    }
+
+    m_evaluated = true;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
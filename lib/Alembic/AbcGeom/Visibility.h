@@ -38,8 +38,11 @@
 #define _Alembic_AbcGeom_Visibility_h_
 
 #include <string.h>
+#include <map>
+#include <vector>
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/FlattenedHierarchy.h>
 #include <Alembic/Abc/OSchemaObject.h>
 
 
@@ -125,6 +128,71 @@ IsAncestorInvisible( IObject schemaObject,
                      const Abc::ISampleSelector &iSS =
                      Abc::ISampleSelector () );
 
+//-*****************************************************************************
+//! Resolves the visibility of every object under a root in one pass, instead
+//! of calling IsAncestorInvisible on each object.
+//!
+//! The hierarchy is walked and the visibility properties are looked up once,
+//! at construction.  Objects get indices in parent before child order.
+//! Constant visibility properties are only read on the first call to
+//! evaluate.  Visibility inherited from above the root is taken into account.
+//!
+//! Objects which are hidden for all time are added, but their children are
+//! never expanded, so nothing below them is in the cache.  Because of that
+//! the indices don't line up with those of a WorldXformCache over the same
+//! root, pair objects across the two with getFullName and getIndex instead.
+class ALEMBIC_EXPORT VisibilityCache : public FlattenedHierarchy
+{
+public:
+    VisibilityCache();
+
+    explicit VisibilityCache( const Abc::IObject & iRoot );
+
+    explicit VisibilityCache( Abc::IArchive & iArchive );
+
+    //! Resolves the visibility of every object at iSS.
+    void evaluate( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    //! Whether the object is visible, after inheriting deferred visibility.
+    bool isVisible( size_t iIndex ) const { return m_visible[iIndex]; }
+
+    //! True when neither the object nor anything below it is visible, so
+    //! the whole branch can be skipped.
+    bool isSubtreeHidden( size_t iIndex ) const
+    { return !m_subtreeVisible[iIndex]; }
+
+    //! The value of the object's own visibility property, kVisibilityDeferred
+    //! if it doesn't have one.
+    ObjectVisibility getVisibility( size_t iIndex ) const
+    { return ObjectVisibility( m_values[iIndex] ); }
+
+    //! Whether the resolved visibility of this object never changes.
+    bool isConstant( size_t iIndex ) const { return m_isConstant[iIndex]; }
+
+protected:
+    virtual bool addObject( const Abc::IObject & iObject, size_t iIndex,
+                            size_t iParent );
+
+private:
+    void init( const Abc::IObject & iRoot );
+
+    std::vector< IVisibilityProperty > m_properties;
+    std::vector< bool > m_isConstant;
+
+    // whether the object is constant and hidden, only used while walking
+    std::vector< bool > m_constantHidden;
+    std::vector< int8_t > m_values;
+    std::vector< bool > m_visible;
+    std::vector< bool > m_subtreeVisible;
+
+    // the parent of the root, to inherit visibility from above the root
+    Abc::IObject m_rootParent;
+    bool m_rootConstant;
+    bool m_rootHidden;
+
+    bool m_evaluated;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
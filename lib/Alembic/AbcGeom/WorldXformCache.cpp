@@ -0,0 +1,161 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/WorldXformCache.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+WorldXformCache::WorldXformCache()
+    : m_evaluated( false )
+{
+}
+
+//-*****************************************************************************
+WorldXformCache::WorldXformCache( const Abc::IObject & iRoot )
+    : m_evaluated( false )
+{
+    init( iRoot );
+}
+
+//-*****************************************************************************
+WorldXformCache::WorldXformCache( Abc::IArchive & iArchive )
+    : m_evaluated( false )
+{
+    init( iArchive.getTop() );
+}
+
+//-*****************************************************************************
+void WorldXformCache::init( const Abc::IObject & iRoot )
+{
+    flatten( iRoot );
+
+    Abc::M44d identity;
+    identity.makeIdentity();
+    m_matrices.resize( m_objects.size(), identity );
+}
+
+//-*****************************************************************************
+bool WorldXformCache::addObject( const Abc::IObject & iObject, size_t iIndex,
+                                 size_t iParent )
+{
+    bool isConstant = ( iParent == kInvalidIndex || m_isConstant[iParent] );
+    if ( IXform::matches( iObject.getHeader() ) )
+    {
+        IXform xform( iObject, kWrapExisting );
+        m_xforms.push_back( xform.getSchema() );
+        isConstant = isConstant && m_xforms.back().isConstant();
+    }
+    else
+    {
+        m_xforms.push_back( IXformSchema() );
+    }
+
+    m_isConstant.push_back( isConstant );
+    if ( !isConstant )
+    {
+        m_animated.push_back( iIndex );
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+void WorldXformCache::evaluateObject( size_t iIndex,
+                                      const Abc::ISampleSelector &iSS )
+{
+    size_t parent = m_parents[iIndex];
+    IXformSchema & xform = m_xforms[iIndex];
+
+    if ( !xform.valid() )
+    {
+        if ( parent != kInvalidIndex )
+        {
+            m_matrices[iIndex] = m_matrices[parent];
+        }
+        return;
+    }
+
+    bool inherits = true;
+    Abc::M44d local;
+
+    if ( xform.isConstantIdentity() )
+    {
+        local.makeIdentity();
+        inherits = xform.getInheritsXforms( iSS );
+    }
+    else
+    {
+        inherits = xform.getMatrix( local, m_channels, iSS );
+    }
+
+    if ( inherits && parent != kInvalidIndex )
+    {
+        m_matrices[iIndex] = local * m_matrices[parent];
+    }
+    else
+    {
+        m_matrices[iIndex] = local;
+    }
+}
+
+//-*****************************************************************************
+void WorldXformCache::evaluate( const Abc::ISampleSelector &iSS )
+{
+    if ( !m_evaluated )
+    {
+        for ( size_t i = 0; i < m_objects.size(); ++i )
+        {
+            evaluateObject( i, iSS );
+        }
+        m_evaluated = true;
+        return;
+    }
+
+    // the constant ones, and so every ancestor of an animated one that is
+    // constant, still hold what the first evaluate gave them
+    std::vector< size_t >::const_iterator it = m_animated.begin();
+    for ( ; it != m_animated.end(); ++it )
+    {
+        evaluateObject( *it, iSS );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,117 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_WorldXformCache_h_
+#define _Alembic_AbcGeom_WorldXformCache_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/FlattenedHierarchy.h>
+#include <Alembic/AbcGeom/IXform.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Evaluates the world space matrices of every object under a root (usually
+//! the top object of an archive) in one pass.
+//!
+//! The hierarchy is walked once, at construction, and flattened so that
+//! every object gets an index and a parent always comes before its children.
+//! Objects which aren't xforms get the world matrix of their parent, so a
+//! mesh can look up its own index to find where it sits in the world.
+//!
+//! An object whose xform and every ancestor xform are constant only gets
+//! evaluated on the first call to evaluate, after that only the animated
+//! objects are visited.  Constant identity xforms are never read.
+class ALEMBIC_EXPORT WorldXformCache : public FlattenedHierarchy
+{
+public:
+    WorldXformCache();
+
+    //! Walks the hierarchy under iRoot, the ancestors of iRoot are not
+    //! taken into account.  No matrices are valid until evaluate is called.
+    explicit WorldXformCache( const Abc::IObject & iRoot );
+
+    //! Walks the hierarchy under the top object of iArchive.
+    explicit WorldXformCache( Abc::IArchive & iArchive );
+
+    //! Computes the world matrices at iSS.
+    void evaluate( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    //! The world matrices from the last evaluate, one per object,
+    //! or NULL if there are no objects.
+    const Abc::M44d * getMatrices() const
+    { return m_matrices.empty() ? NULL : &m_matrices.front(); }
+
+    const Abc::M44d & getMatrix( size_t iIndex ) const
+    { return m_matrices[iIndex]; }
+
+    //! Whether the world matrix of this object never changes over time.
+    bool isConstant( size_t iIndex ) const { return m_isConstant[iIndex]; }
+
+protected:
+    virtual bool addObject( const Abc::IObject & iObject, size_t iIndex,
+                            size_t iParent );
+
+private:
+    void init( const Abc::IObject & iRoot );
+
+    void evaluateObject( size_t iIndex, const Abc::ISampleSelector &iSS );
+
+    std::vector< IXformSchema > m_xforms;
+    std::vector< bool > m_isConstant;
+    std::vector< Abc::M44d > m_matrices;
+
+    // indices of the objects which need to be evaluated every time,
+    // in parent before child order
+    std::vector< size_t > m_animated;
+
+    // reused by every IXformSchema::getMatrix
+    std::vector< Alembic::Util::float64_t > m_channels;
+
+    bool m_evaluated;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
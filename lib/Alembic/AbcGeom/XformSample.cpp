@@ -547,72 +547,233 @@ void XformSample::setMatrix( const Abc::M44d &iMatrix )
 }
 
 //-*****************************************************************************
-Abc::M44d XformSample::getMatrix() const
+// The channel values of one op, for XformSample::getMatrix
+class OpChannels
 {
-    Abc::M44d ret;
-    ret.makeIdentity();
+public:
+    explicit OpChannels( const XformOp &iOp ) : m_op( iOp ) {}
 
-    for ( std::size_t i = 0 ; i < m_ops.size() ; ++i )
+    double operator[]( std::size_t iIndex ) const
+    { return m_op.getChannelValue( iIndex ); }
+
+private:
+    const XformOp &m_op;
+};
+
+//-*****************************************************************************
+// Channel values which are iStride values apart, for ComposeXformOps
+class StridedChannels
+{
+public:
+    StridedChannels( const Alembic::Util::float64_t *iChannels,
+                     std::size_t iStride )
+        : m_channels( iChannels ), m_stride( iStride ) {}
+
+    double operator[]( std::size_t iIndex ) const
+    { return m_channels[iIndex * m_stride]; }
+
+    void advance( std::size_t iNumChannels )
+    { m_channels += iNumChannels * m_stride; }
+
+private:
+    const Alembic::Util::float64_t *m_channels;
+    std::size_t m_stride;
+};
+
+//-*****************************************************************************
+// ioRows = r * ioRows for the rotation in the upper 3x3 of r
+static void rotateRows( const Abc::M44d &r, Abc::M44d &ioRows )
+{
+    double (*x)[4] = ioRows.x;
+    for ( std::size_t j = 0; j < 4; ++j )
     {
-        Abc::M44d m;
-        m.makeIdentity();
+        double a = x[0][j];
+        double b = x[1][j];
+        double c = x[2][j];
+        x[0][j] = r.x[0][0] * a + r.x[0][1] * b + r.x[0][2] * c;
+        x[1][j] = r.x[1][0] * a + r.x[1][1] * b + r.x[1][2] * c;
+        x[2][j] = r.x[2][0] * a + r.x[2][1] * b + r.x[2][2] * c;
+    }
+}
 
-        XformOp op = m_ops[i];
+//-*****************************************************************************
+// ioRows = r * ioRows where r rotates iAngle radians in the plane of rows
+// iRow0 and iRow1, which is what setAxisAngle gives for the X, Y and Z axes
+static void rotateRows( std::size_t iRow0, std::size_t iRow1, double iAngle,
+                        Abc::M44d &ioRows )
+{
+    double sine = sin( iAngle );
+    double cosine = cos( iAngle );
+    double (*x)[4] = ioRows.x;
+    for ( std::size_t j = 0; j < 4; ++j )
+    {
+        double a = x[iRow0][j];
+        double b = x[iRow1][j];
+        x[iRow0][j] = cosine * a + sine * b;
+        x[iRow1][j] = cosine * b - sine * a;
+    }
+}
 
-        XformOperationType otype = op.getType();
+//-*****************************************************************************
+// Each op is a matrix m which gets composed as ioMatrix = m * ioMatrix.
+// Translates, scales and rotations only touch a few rows of the result, so
+// instead of building m and doing a full 4x4 multiply, just those rows are
+// updated.  A TRS stack, or a Maya one with its pivot translates, never
+// needs a full multiply at all.
+template <class CHANNELS>
+static void applyOp( XformOperationType iType, const CHANNELS &iChannels,
+                     Abc::M44d &ioMatrix )
+{
+    double (*x)[4] = ioMatrix.x;
 
-        if ( otype == kMatrixOperation )
+    switch ( iType )
+    {
+    case kScaleOperation:
+        for ( std::size_t i = 0; i < 3; ++i )
         {
-            for ( std::size_t j = 0 ; j < 4 ; ++j )
+            double s = iChannels[i];
+            for ( std::size_t j = 0; j < 4; ++j )
             {
-                for ( std::size_t k = 0 ; k < 4 ; ++k )
-                {
-                    m.x[j][k] = op.getChannelValue( ( 4 * j ) + k );
-                }
+                x[i][j] *= s;
             }
         }
-        else if ( otype == kRotateXOperation )
-        {
-            m.setAxisAngle( Abc::V3d( 1.0, 0.0, 0.0 ),
-                            DegreesToRadians( op.getChannelValue( 0 ) ) );
-        }
-        else if ( otype == kRotateYOperation )
-        {
-            m.setAxisAngle( Abc::V3d( 0.0, 1.0, 0.0 ),
-                            DegreesToRadians( op.getChannelValue( 0 ) ) );
-        }
-        else if ( otype == kRotateZOperation )
+        break;
+
+    case kTranslateOperation:
+    {
+        double tx = iChannels[0];
+        double ty = iChannels[1];
+        double tz = iChannels[2];
+        for ( std::size_t j = 0; j < 4; ++j )
         {
-            m.setAxisAngle( Abc::V3d( 0.0, 0.0, 1.0 ),
-                            DegreesToRadians( op.getChannelValue( 0 ) ) );
+            x[3][j] += tx * x[0][j] + ty * x[1][j] + tz * x[2][j];
         }
-        else
-        {
-            Abc::V3d vec( op.getChannelValue( 0 ),
-                          op.getChannelValue( 1 ),
-                          op.getChannelValue( 2 ) );
+    }
+    break;
 
-            if ( otype == kScaleOperation )
-            {
-                m.setScale( vec );
-            }
-            else if ( otype == kTranslateOperation )
+    case kRotateXOperation:
+        rotateRows( 1, 2, DegreesToRadians( iChannels[0] ), ioMatrix );
+        break;
+
+    case kRotateYOperation:
+        rotateRows( 2, 0, DegreesToRadians( iChannels[0] ), ioMatrix );
+        break;
+
+    case kRotateZOperation:
+        rotateRows( 0, 1, DegreesToRadians( iChannels[0] ), ioMatrix );
+        break;
+
+    case kRotateOperation:
+    {
+        Abc::M44d r;
+        r.setAxisAngle( Abc::V3d( iChannels[0], iChannels[1], iChannels[2] ),
+                        DegreesToRadians( iChannels[3] ) );
+        rotateRows( r, ioMatrix );
+    }
+    break;
+
+    case kMatrixOperation:
+    {
+        Abc::M44d m;
+        for ( std::size_t j = 0 ; j < 4 ; ++j )
+        {
+            for ( std::size_t k = 0 ; k < 4 ; ++k )
             {
-                m.setTranslation( vec );
+                m.x[j][k] = iChannels[( 4 * j ) + k];
             }
-            else if ( otype == kRotateOperation )
+        }
+        ioMatrix = m * ioMatrix;
+    }
+    break;
+    }
+}
+
+//-*****************************************************************************
+static std::size_t numChannels( XformOperationType iType )
+{
+    switch ( iType )
+    {
+    case kScaleOperation:
+    case kTranslateOperation:
+        return 3;
+    case kRotateOperation:
+        return 4;
+    case kMatrixOperation:
+        return 16;
+    default:
+        return 1;
+    }
+}
+
+//-*****************************************************************************
+static Abc::M44d composeOps( const XformOperationType *iOps,
+                             std::size_t iNumOps,
+                             StridedChannels iChannels )
+{
+    Abc::M44d ret;
+
+    // a lone matrix, which is what most baked xforms are
+    if ( iNumOps == 1 && iOps[0] == kMatrixOperation )
+    {
+        for ( std::size_t j = 0 ; j < 4 ; ++j )
+        {
+            for ( std::size_t k = 0 ; k < 4 ; ++k )
             {
-                m.setAxisAngle( vec,
-                                DegreesToRadians( op.getChannelValue( 3 ) ) );
+                ret.x[j][k] = iChannels[( 4 * j ) + k];
             }
-
         }
-        ret = m * ret;
+        return ret;
+    }
+
+    ret.makeIdentity();
+
+    for ( std::size_t i = 0 ; i < iNumOps ; ++i )
+    {
+        applyOp( iOps[i], iChannels, ret );
+        iChannels.advance( numChannels( iOps[i] ) );
     }
 
     return ret;
 }
 
+//-*****************************************************************************
+Abc::M44d XformSample::getMatrix() const
+{
+    Abc::M44d ret;
+    ret.makeIdentity();
+
+    for ( std::size_t i = 0 ; i < m_ops.size() ; ++i )
+    {
+        const XformOp &op = m_ops[i];
+        applyOp( op.getType(), OpChannels( op ), ret );
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+Abc::M44d ComposeXformOps( const XformOperationType *iOps,
+                           std::size_t iNumOps,
+                           const Alembic::Util::float64_t *iChannels )
+{
+    return composeOps( iOps, iNumOps, StridedChannels( iChannels, 1 ) );
+}
+
+//-*****************************************************************************
+void ComposeXformOps( const XformOperationType *iOps,
+                      std::size_t iNumOps,
+                      const Alembic::Util::float64_t *iChannels,
+                      std::size_t iNumSamples,
+                      Abc::M44d *oMatrices )
+{
+    for ( std::size_t s = 0; s < iNumSamples; ++s )
+    {
+        oMatrices[s] = composeOps( iOps, iNumOps,
+                                   StridedChannels( iChannels + s,
+                                                    iNumSamples ) );
+    }
+}
+
 //-*****************************************************************************
 Abc::V3d XformSample::getTranslation() const
 {
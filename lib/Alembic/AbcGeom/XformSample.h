@@ -149,6 +149,23 @@ private:
     size_t m_opIndex;
 };
 
+//-*****************************************************************************
+//! Composes a matrix the same way XformSample::getMatrix does, but from
+//! just the op types and their channel values, laid out one op after
+//! another like they are in the .vals property of an xform.
+ALEMBIC_EXPORT Abc::M44d
+ComposeXformOps( const XformOperationType *iOps, std::size_t iNumOps,
+                 const Alembic::Util::float64_t *iChannels );
+
+//! Batch version of the above for iNumSamples samples which all have the
+//! same ops, such as every sample of one xform or a crowd of xforms built
+//! the same way.  The channels are in structure of arrays form, channel c
+//! of sample s is iChannels[c * iNumSamples + s].  oMatrices must have room
+//! for iNumSamples matrices.
+ALEMBIC_EXPORT void
+ComposeXformOps( const XformOperationType *iOps, std::size_t iNumOps,
+                 const Alembic::Util::float64_t *iChannels,
+                 std::size_t iNumSamples, Abc::M44d *oMatrices );
 
 } // End namespace ALEMBIC_VERSION_NS
 
@@ -0,0 +1,227 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Threads.h>
+#include <Alembic/Util/Exception.h>
+
+#include <string>
+#include <vector>
+#include <assert.h>
+
+using namespace Alembic::Util;
+
+namespace {
+
+struct Counts
+{
+    mutex lock;
+    std::vector< int > hits;
+    std::size_t numRanges;
+};
+
+void countThread( std::size_t iThread, void * iData )
+{
+    Counts * counts = static_cast< Counts * >( iData );
+    scoped_lock l( counts->lock );
+    counts->hits[iThread]++;
+}
+
+void countRange( std::size_t iRange, std::size_t iBegin, std::size_t iEnd,
+                 void * iData )
+{
+    // each item belongs to exactly one range, so no lock is needed
+    Counts * counts = static_cast< Counts * >( iData );
+    assert( iRange < counts->numRanges );
+    for ( std::size_t i = iBegin; i < iEnd; ++i )
+    {
+        counts->hits[i]++;
+    }
+}
+
+void countTask( std::size_t iTask, void * iData )
+{
+    Counts * counts = static_cast< Counts * >( iData );
+    scoped_lock l( counts->lock );
+    counts->hits[iTask]++;
+}
+
+// counts every thread like countThread, but throws from iThrowOn
+struct Thrower
+{
+    Counts counts;
+    std::size_t throwOn;
+};
+
+void countOrThrow( std::size_t iThread, void * iData )
+{
+    Thrower * thrower = static_cast< Thrower * >( iData );
+    countThread( iThread, &thrower->counts );
+    if ( iThread == thrower->throwOn )
+    {
+        ALEMBIC_THROW( "thrown by " << iThread );
+    }
+}
+
+struct Waiter
+{
+    condition_mutex lock;
+    bool ready;
+    std::size_t woken;
+};
+
+void waitOrSignal( std::size_t iThread, void * iData )
+{
+    Waiter * waiter = static_cast< Waiter * >( iData );
+    scoped_condition_lock l( waiter->lock );
+    if ( iThread == 0 )
+    {
+        waiter->ready = true;
+        waiter->lock.notify_all();
+        return;
+    }
+
+    while ( !waiter->ready )
+    {
+        waiter->lock.wait();
+    }
+    waiter->woken++;
+}
+
+}
+
+int main( int argc, char* argv[] )
+{
+    assert( GetNumProcessors() >= 1 );
+
+    {
+        Counts counts;
+        counts.hits.resize( 7, 0 );
+        RunThreads( 7, countThread, &counts );
+        for ( std::size_t i = 0; i < 7; ++i )
+        {
+            assert( counts.hits[i] == 1 );
+        }
+    }
+
+    // automatic range counts stay on one thread for small loops and never
+    // go past the number of items
+    assert( GetNumRanges( 10, 0, 100 ) == 1 );
+    assert( GetNumRanges( 10, 4, 100 ) == 4 );
+    assert( GetNumRanges( 3, 8, 100 ) == 3 );
+    assert( GetNumRanges( 0, 8, 100 ) == 1 );
+    assert( GetNumRanges( 1000, 0, 100 ) >= 1 );
+    assert( GetNumRanges( 1000, 0, 100 ) <= GetNumProcessors() );
+
+    for ( std::size_t numRanges = 1; numRanges < 9; ++numRanges )
+    {
+        Counts counts;
+        counts.hits.resize( 1001, 0 );
+        counts.numRanges = numRanges;
+        ParallelRanges( counts.hits.size(), numRanges, countRange, &counts );
+        for ( std::size_t i = 0; i < counts.hits.size(); ++i )
+        {
+            assert( counts.hits[i] == 1 );
+        }
+    }
+
+    {
+        Counts counts;
+        counts.hits.resize( 100, 0 );
+        ParallelTasks( counts.hits.size(), 4, countTask, &counts );
+        ParallelTasks( counts.hits.size(), 0, countTask, &counts );
+        for ( std::size_t i = 0; i < counts.hits.size(); ++i )
+        {
+            assert( counts.hits[i] == 2 );
+        }
+    }
+
+    // the exception of a started thread or of the calling one is thrown
+    // again once every thread is done
+    for ( std::size_t throwOn = 0; throwOn < 2; ++throwOn )
+    {
+        Thrower thrower;
+        thrower.counts.hits.resize( 4, 0 );
+        thrower.throwOn = throwOn;
+
+        bool caught = false;
+        try
+        {
+            RunThreads( 4, countOrThrow, &thrower );
+        }
+        catch ( Exception & e )
+        {
+            caught = std::string( e.what() ).find( "thrown by" ) !=
+                std::string::npos;
+        }
+
+        assert( caught );
+        for ( std::size_t i = 0; i < 4; ++i )
+        {
+            assert( thrower.counts.hits[i] == 1 );
+        }
+    }
+
+    // no more tasks are started once one throws
+    {
+        Thrower thrower;
+        thrower.counts.hits.resize( 1000, 0 );
+        thrower.throwOn = 0;
+
+        bool caught = false;
+        try
+        {
+            ParallelTasks( thrower.counts.hits.size(), 1, countOrThrow,
+                           &thrower );
+        }
+        catch ( Exception & )
+        {
+            caught = true;
+        }
+
+        assert( caught );
+        assert( thrower.counts.hits[0] == 1 && thrower.counts.hits[1] == 0 );
+    }
+
+    {
+        Waiter waiter;
+        waiter.ready = false;
+        waiter.woken = 0;
+        RunThreads( 4, waitOrSignal, &waiter );
+        assert( waiter.woken == 3 );
+    }
+
+    return 0;
+}
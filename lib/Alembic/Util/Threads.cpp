@@ -0,0 +1,400 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Threads.h>
+#include <Alembic/Util/Exception.h>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+namespace { // anonymous
+
+//-*****************************************************************************
+// The first exception thrown by any of the threads of a RunThreads, which
+// is thrown again once all of them are done.
+struct ThreadError
+{
+    ThreadError() : failed( false ) {}
+
+    void record( const std::string & iWhat )
+    {
+        scoped_lock l( lock );
+        if ( !failed )
+        {
+            failed = true;
+            what = iWhat;
+        }
+    }
+
+    mutex lock;
+    bool failed;
+    std::string what;
+};
+
+//-*****************************************************************************
+struct ThreadArgs
+{
+    ThreadFunc func;
+    void * data;
+    std::size_t thread;
+    ThreadError * error;
+};
+
+void runThread( ThreadArgs & iArgs )
+{
+    try
+    {
+        iArgs.func( iArgs.thread, iArgs.data );
+    }
+    catch ( std::exception & e )
+    {
+        iArgs.error->record( e.what() );
+    }
+    catch ( ... )
+    {
+        iArgs.error->record( "Unknown exception" );
+    }
+}
+
+#ifdef _MSC_VER
+DWORD WINAPI threadEntry( LPVOID iArgs )
+{
+    runThread( *static_cast< ThreadArgs * >( iArgs ) );
+    return 0;
+}
+#else
+void * threadEntry( void * iArgs )
+{
+    runThread( *static_cast< ThreadArgs * >( iArgs ) );
+    return NULL;
+}
+#endif
+
+//-*****************************************************************************
+struct RangeArgs
+{
+    RangeFunc func;
+    void * data;
+    std::size_t numItems;
+    std::size_t numRanges;
+};
+
+void runRange( std::size_t iRange, void * iData )
+{
+    RangeArgs * args = static_cast< RangeArgs * >( iData );
+
+    // the last range picks up the remainder
+    std::size_t perRange = args->numItems / args->numRanges;
+    std::size_t begin = iRange * perRange;
+    std::size_t end = ( iRange + 1 == args->numRanges ) ?
+        args->numItems : begin + perRange;
+
+    args->func( iRange, begin, end, args->data );
+}
+
+//-*****************************************************************************
+struct TaskArgs
+{
+    TaskFunc func;
+    void * data;
+    std::size_t numTasks;
+
+    mutex lock;
+    std::size_t next;
+};
+
+void runTasks( std::size_t iThread, void * iData )
+{
+    TaskArgs * args = static_cast< TaskArgs * >( iData );
+    for ( ;; )
+    {
+        std::size_t task = 0;
+        {
+            scoped_lock l( args->lock );
+            if ( args->next >= args->numTasks )
+            {
+                return;
+            }
+            task = args->next++;
+        }
+
+        try
+        {
+            args->func( task, args->data );
+        }
+        catch ( ... )
+        {
+            // hand out no more tasks, RunThreads reports the exception
+            scoped_lock l( args->lock );
+            args->next = args->numTasks;
+            throw;
+        }
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+std::size_t GetNumProcessors()
+{
+    long numProcs = 1;
+#ifdef _MSC_VER
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    numProcs = info.dwNumberOfProcessors;
+#else
+    numProcs = sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+
+    return numProcs > 0 ? static_cast< std::size_t >( numProcs ) : 1;
+}
+
+//-*****************************************************************************
+void RunThreads( std::size_t iNumThreads, ThreadFunc iFunc, void * iData )
+{
+    if ( iNumThreads == 0 )
+    {
+        return;
+    }
+
+    ThreadError error;
+    std::vector< ThreadArgs > args( iNumThreads );
+    for ( std::size_t i = 0; i < iNumThreads; ++i )
+    {
+        args[i].func = iFunc;
+        args[i].data = iData;
+        args[i].thread = i;
+        args[i].error = &error;
+    }
+
+    std::vector< std::size_t > notStarted;
+
+#ifdef _MSC_VER
+    std::vector< HANDLE > threads;
+    for ( std::size_t i = 1; i < iNumThreads; ++i )
+    {
+        HANDLE t = CreateThread( NULL, 0, threadEntry, &args[i], 0, NULL );
+        if ( t == NULL )
+        {
+            notStarted.push_back( i );
+        }
+        else
+        {
+            threads.push_back( t );
+        }
+    }
+
+    runThread( args[0] );
+
+    for ( std::size_t i = 0; i < notStarted.size(); ++i )
+    {
+        runThread( args[notStarted[i]] );
+    }
+
+    for ( std::size_t i = 0; i < threads.size(); ++i )
+    {
+        WaitForSingleObject( threads[i], INFINITE );
+        CloseHandle( threads[i] );
+    }
+#else
+    std::vector< pthread_t > threads;
+    for ( std::size_t i = 1; i < iNumThreads; ++i )
+    {
+        pthread_t t;
+        if ( pthread_create( &t, NULL, threadEntry, &args[i] ) != 0 )
+        {
+            notStarted.push_back( i );
+        }
+        else
+        {
+            threads.push_back( t );
+        }
+    }
+
+    runThread( args[0] );
+
+    for ( std::size_t i = 0; i < notStarted.size(); ++i )
+    {
+        runThread( args[notStarted[i]] );
+    }
+
+    for ( std::size_t i = 0; i < threads.size(); ++i )
+    {
+        pthread_join( threads[i], NULL );
+    }
+#endif
+
+    if ( error.failed )
+    {
+        ALEMBIC_THROW( error.what );
+    }
+}
+
+//-*****************************************************************************
+std::size_t GetNumRanges( std::size_t iNumItems, std::size_t iNumThreads,
+                          std::size_t iMinItemsPerThread )
+{
+    std::size_t numRanges = iNumThreads;
+    if ( numRanges == 0 )
+    {
+        numRanges = 1;
+        if ( iMinItemsPerThread > 0 && iNumItems >= 4 * iMinItemsPerThread )
+        {
+            numRanges = std::min( GetNumProcessors(),
+                                  iNumItems / iMinItemsPerThread );
+        }
+    }
+
+    return std::max( std::min( numRanges, iNumItems ), ( std::size_t ) 1 );
+}
+
+//-*****************************************************************************
+void ParallelRanges( std::size_t iNumItems, std::size_t iNumRanges,
+                     RangeFunc iFunc, void * iData )
+{
+    if ( iNumItems == 0 || iNumRanges == 0 )
+    {
+        return;
+    }
+
+    RangeArgs args;
+    args.func = iFunc;
+    args.data = iData;
+    args.numItems = iNumItems;
+    args.numRanges = std::min( iNumRanges, iNumItems );
+
+    RunThreads( args.numRanges, runRange, &args );
+}
+
+//-*****************************************************************************
+void ParallelTasks( std::size_t iNumTasks, std::size_t iNumThreads,
+                    TaskFunc iFunc, void * iData )
+{
+    if ( iNumTasks == 0 )
+    {
+        return;
+    }
+
+    TaskArgs args;
+    args.func = iFunc;
+    args.data = iData;
+    args.numTasks = iNumTasks;
+    args.next = 0;
+
+    std::size_t numThreads = iNumThreads > 0 ? iNumThreads :
+        GetNumProcessors();
+
+    RunThreads( std::min( numThreads, iNumTasks ), runTasks, &args );
+}
+
+//-*****************************************************************************
+#ifdef _MSC_VER
+
+condition_mutex::condition_mutex()
+{
+    InitializeCriticalSection( &m_lock );
+    InitializeConditionVariable( &m_cond );
+}
+
+condition_mutex::~condition_mutex()
+{
+    DeleteCriticalSection( &m_lock );
+}
+
+void condition_mutex::lock()
+{
+    EnterCriticalSection( &m_lock );
+}
+
+void condition_mutex::unlock()
+{
+    LeaveCriticalSection( &m_lock );
+}
+
+void condition_mutex::wait()
+{
+    SleepConditionVariableCS( &m_cond, &m_lock, INFINITE );
+}
+
+void condition_mutex::notify_all()
+{
+    WakeAllConditionVariable( &m_cond );
+}
+
+#else
+
+condition_mutex::condition_mutex()
+{
+    pthread_mutex_init( &m_lock, NULL );
+    pthread_cond_init( &m_cond, NULL );
+}
+
+condition_mutex::~condition_mutex()
+{
+    pthread_cond_destroy( &m_cond );
+    pthread_mutex_destroy( &m_lock );
+}
+
+void condition_mutex::lock()
+{
+    pthread_mutex_lock( &m_lock );
+}
+
+void condition_mutex::unlock()
+{
+    pthread_mutex_unlock( &m_lock );
+}
+
+void condition_mutex::wait()
+{
+    pthread_cond_wait( &m_cond, &m_lock );
+}
+
+void condition_mutex::notify_all()
+{
+    pthread_cond_broadcast( &m_cond );
+}
+
+#endif
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,153 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2009-2016,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Util_Threads_h_
+#define _Alembic_Util_Threads_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+
+#ifndef _MSC_VER
+#include <pthread.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Returns the number of processors on this machine, at least 1.
+ALEMBIC_EXPORT std::size_t GetNumProcessors();
+
+//-*****************************************************************************
+typedef void ( *ThreadFunc )( std::size_t iThread, void * iData );
+
+//! Calls iFunc once for every iThread in [0, iNumThreads) concurrently and
+//! returns once all of them have.  The calling thread runs thread 0, the
+//! others are started for it.  If a thread can't be started, its call is
+//! made from the calling thread instead once thread 0 is done.
+//! An exception thrown by iFunc doesn't stop the other threads, once all of
+//! them are done the message of the first one is thrown again as an
+//! Alembic::Util::Exception.  ParallelRanges and ParallelTasks do the same,
+//! ParallelTasks starts no more tasks after one has thrown.
+ALEMBIC_EXPORT void
+RunThreads( std::size_t iNumThreads, ThreadFunc iFunc, void * iData );
+
+//-*****************************************************************************
+typedef void ( *RangeFunc )( std::size_t iRange, std::size_t iBegin,
+                             std::size_t iEnd, void * iData );
+
+//! Returns how many ranges ParallelRanges should split iNumItems into.
+//! A non zero iNumThreads is used as is, 0 picks one thread per
+//! iMinItemsPerThread items up to the number of processors, staying on a
+//! single thread for fewer than 4 times that many items since starting
+//! threads would cost more than it saves.  Never more than iNumItems,
+//! never less than 1.
+ALEMBIC_EXPORT std::size_t
+GetNumRanges( std::size_t iNumItems, std::size_t iNumThreads,
+              std::size_t iMinItemsPerThread );
+
+//! Splits [0, iNumItems) into iNumRanges contiguous ranges of about the same
+//! size and calls iFunc on each of them, each on its own thread.
+ALEMBIC_EXPORT void
+ParallelRanges( std::size_t iNumItems, std::size_t iNumRanges,
+                RangeFunc iFunc, void * iData );
+
+//-*****************************************************************************
+typedef void ( *TaskFunc )( std::size_t iTask, void * iData );
+
+//! Calls iFunc for every iTask in [0, iNumTasks) using up to iNumThreads
+//! threads, 0 for one per processor.  Each thread takes the next task as
+//! soon as it is done with the last one, so tasks that take very different
+//! amounts of time still keep every thread busy.
+ALEMBIC_EXPORT void
+ParallelTasks( std::size_t iNumTasks, std::size_t iNumThreads,
+               TaskFunc iFunc, void * iData );
+
+//-*****************************************************************************
+//! A mutex which the thread holding it can also wait on until another
+//! thread calls notify_all, like a mutex paired with a condition variable.
+class ALEMBIC_EXPORT condition_mutex : noncopyable
+{
+public:
+    condition_mutex();
+    ~condition_mutex();
+
+    void lock();
+    void unlock();
+
+    //! Gives up the lock until notified and takes it again before
+    //! returning, it can also return without having been notified.
+    void wait();
+
+    //! Wakes every thread waiting on this.
+    void notify_all();
+
+private:
+#ifdef _MSC_VER
+    CRITICAL_SECTION m_lock;
+    CONDITION_VARIABLE m_cond;
+#else
+    pthread_mutex_t m_lock;
+    pthread_cond_t m_cond;
+#endif
+};
+
+class scoped_condition_lock : noncopyable
+{
+public:
+    scoped_condition_lock( condition_mutex & l ) : m( l )
+    {
+        m.lock();
+    }
+
+    ~scoped_condition_lock()
+    {
+        m.unlock();
+    }
+
+private:
+    condition_mutex & m;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif